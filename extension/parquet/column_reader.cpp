@@ -236,6 +236,9 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips of the previous row group that were never applied do not carry over
+	pending_skips = 0;
+	page_rows_available = 0;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -582,8 +585,52 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats() || page_rows_available > 0 || reader.parquet_options.encryption_config) {
+		// we can only skip entire pages if the rows of the page are known from the page header
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+	idx_t skipped = 0;
+	while (skipped < num_values) {
+		auto page_offset = trans.GetLocation();
+		PageHeader page_hdr;
+		reader.Read(page_hdr, *protocol);
+		if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+			// the dictionary is needed for the pages that follow
+			trans.SetLocation(page_offset);
+			PrepareRead(none_filter);
+			continue;
+		}
+		idx_t page_rows;
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_rows = NumericCast<idx_t>(page_hdr.data_page_header.num_values);
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_rows = NumericCast<idx_t>(page_hdr.data_page_header_v2.num_values);
+		} else {
+			page_rows = NumericLimits<idx_t>::Maximum();
+		}
+		if (page_rows > num_values - skipped) {
+			// we need (part of) this page: read it as usual
+			trans.SetLocation(page_offset);
+			break;
+		}
+		// skip over the compressed page data without decompressing it
+		trans.SetLocation(trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size));
+		skipped += page_rows;
+	}
+	group_rows_available -= skipped;
+	chunk_read_offset = trans.GetLocation();
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	num_values -= SkipPages(num_values);
+	if (num_values == 0) {
+		return;
+	}
 
 	dummy_define.zero();
 	dummy_repeat.zero();
@@ -37,6 +37,7 @@ using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -69,6 +70,10 @@ static uint8_t GetVarintSize(uint32_t val) {
 ColumnWriterStatistics::~ColumnWriterStatistics() {
 }
 
+bool ColumnWriterStatistics::HasStats() {
+	return false;
+}
+
 string ColumnWriterStatistics::GetMin() {
 	return string();
 }
@@ -85,6 +90,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -317,6 +325,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page - only used when writing the page index
+	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -339,6 +349,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the distinct values in the column chunk, used to create the bloom filter
+	unordered_set<uint64_t> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -368,6 +380,8 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	//! The size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! When writing the page index, pages are limited to this many rows so that readers can skip them
+	static constexpr const idx_t PAGE_INDEX_MAX_PAGE_ROWS = 20480;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
@@ -408,6 +422,17 @@ protected:
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Adds the hashes of the (non-NULL) values of a (subset of a) vector to the bloom filter hashes of the state
+	//! Only used for scalar types that support bloom filters.
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
+	void AddBloomFilterHash(BasicColumnWriterState &state, uint64_t hash);
+
+	//! Whether we write the page index (ColumnIndex/OffsetIndex) for this column - only for non-repeated columns
+	bool WritePageIndex() const;
+	//! Creates the page index and bloom filter of the column chunk
+	unique_ptr<ParquetColumnChunkIndex> CreateColumnChunkIndex(BasicColumnWriterState &state,
+	                                                            vector<PageLocation> page_locations);
+
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
@@ -446,6 +471,8 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	// for the page index we limit the amount of rows per page, so that readers can skip parts of the row group
+	const idx_t max_page_rows = WritePageIndex() ? PAGE_INDEX_MAX_PAGE_ROWS : NumericLimits<idx_t>::Maximum();
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -457,13 +484,13 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-			}
 		}
 		vector_index++;
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE || page_info.row_count >= max_page_rows) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
+		}
 	}
 }
 
@@ -500,6 +527,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (WritePageIndex()) {
+			write_info.stats_state = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -613,8 +643,12 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		// when writing the page index we gather statistics per page, these are merged when finalizing the column
+		auto stats = write_info.stats_state ? write_info.stats_state.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
+		if (writer.WriteBloomFilter()) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -675,6 +709,13 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// merge the statistics of the individual pages
+	for (auto &write_info : state.write_info) {
+		if (write_info.stats_state) {
+			state.stats_state->Merge(*write_info.stats_state);
+		}
+	}
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
 	// flush the dictionary
@@ -692,6 +733,7 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -700,9 +742,93 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type != PageType::DICTIONARY_PAGE) {
+			PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (WritePageIndex() || writer.WriteBloomFilter()) {
+		auto index = CreateColumnChunkIndex(state, std::move(page_locations));
+		if (index) {
+			writer.AddColumnChunkIndex(std::move(index));
+		}
+	}
+}
+
+bool BasicColumnWriter::WritePageIndex() const {
+	return writer.WritePageIndex() && max_repeat == 0;
+}
+
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+}
+
+void BasicColumnWriter::AddBloomFilterHash(BasicColumnWriterState &state, uint64_t hash) {
+	if (state.bloom_filter_hashes.size() > ParquetBloomFilter::MAX_DISTINCT_VALUES) {
+		// too many distinct values for a bloom filter
+		return;
+	}
+	state.bloom_filter_hashes.insert(hash);
+}
+
+unique_ptr<ParquetColumnChunkIndex> BasicColumnWriter::CreateColumnChunkIndex(BasicColumnWriterState &state,
+                                                                              vector<PageLocation> page_locations) {
+	auto result = make_uniq<ParquetColumnChunkIndex>();
+	result->column_idx = state.col_idx;
+	if (WritePageIndex()) {
+		// the offset index contains the location and first row of every data page
+		D_ASSERT(page_locations.size() == state.page_info.size());
+		auto offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			page_locations[page_idx].first_row_index = NumericCast<int64_t>(state.page_info[page_idx].offset);
+		}
+		offset_index->page_locations = std::move(page_locations);
+		result->offset_index = std::move(offset_index);
+
+		// the column index contains the statistics of every data page
+		// we can only write it if we have statistics for every page that is not entirely NULL
+		auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+		column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+		column_index->__isset.null_counts = true;
+		auto first_data_page = state.write_info.size() - state.page_info.size();
+		for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
+			auto &page_info = state.page_info[page_idx];
+			auto &page_stats = *state.write_info[first_data_page + page_idx].stats_state;
+			idx_t null_count = 0;
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				if (state.definition_levels[i] != max_define) {
+					null_count++;
+				}
+			}
+			bool null_page = null_count == page_info.row_count;
+			if (!null_page && !page_stats.HasStats()) {
+				column_index.reset();
+				break;
+			}
+			column_index->null_pages.push_back(null_page);
+			column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+			column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+			column_index->null_counts.push_back(NumericCast<int64_t>(null_count));
+		}
+		result->column_index = std::move(column_index);
+	}
+	auto &hashes = state.bloom_filter_hashes;
+	if (writer.WriteBloomFilter() && !hashes.empty() && hashes.size() <= ParquetBloomFilter::MAX_DISTINCT_VALUES) {
+		result->bloom_filter = ParquetBloomFilter::Create(hashes.size());
+		for (auto &hash : hashes) {
+			result->bloom_filter->Insert(hash);
+		}
+	}
+	if (!result->offset_index && !result->bloom_filter) {
+		return nullptr;
+	}
+	return result;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -756,10 +882,20 @@ public:
 	T max;
 
 public:
-	bool HasStats() {
+	bool HasStats() override {
 		return min <= max;
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
+
 	string GetMin() override {
 		return NumericLimits<SRC>::IsSigned() ? GetMinValue() : string();
 	}
@@ -885,6 +1021,19 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				// the bloom filter hashes the plain encoding of the value
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				AddBloomFilterHash(state, ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
@@ -902,10 +1051,16 @@ public:
 	bool max;
 
 public:
-	bool HasStats() {
+	bool HasStats() override {
 		return !(min && !max);
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
+
 	string GetMin() override {
 		return GetMinValue();
 	}
@@ -1024,10 +1179,18 @@ public:
 		return string(const_char_ptr_cast(buffer), 16);
 	}
 
-	bool HasStats() {
+	bool HasStats() override {
 		return min <= max;
 	}
 
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
+
 	void Update(hugeint_t &val) {
 		if (LessThan::Operation(val, min)) {
 			min = val;
@@ -1190,8 +1353,20 @@ public:
 	string max;
 
 public:
-	bool HasStats() {
-		return has_stats;
+	bool HasStats() override {
+		return has_stats && !values_too_big;
+	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+		} else if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
 	}
 
 	void Update(const string_t &val) {
@@ -1373,6 +1548,11 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (WritePageIndex()) {
+					// the column chunk statistics are computed from the dictionary, but the page index needs them
+					// per page
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1397,6 +1577,23 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the dictionary is hashed when it is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				AddBloomFilterHash(state, ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()),
+				                                                   ptr[r].GetSize()));
+			}
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
@@ -1449,6 +1646,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (writer.WriteBloomFilter()) {
+				AddBloomFilterHash(state, ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()),
+				                                                   value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -109,6 +109,8 @@ protected:
 
 	// applies any skips that were registered using Skip()
 	virtual void ApplyPendingSkips(idx_t num_values);
+	// skips over entire data pages without decompressing them, returns the amount of values that were skipped
+	idx_t SkipPages(idx_t num_values);
 
 	bool HasDefines() {
 		return max_define > 0;
@@ -44,10 +44,13 @@ class ColumnWriterStatistics {
 public:
 	virtual ~ColumnWriterStatistics();
 
+	virtual bool HasStats();
 	virtual string GetMin();
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of another state of the same type (e.g. of a page) into this one
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
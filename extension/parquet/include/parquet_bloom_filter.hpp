@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "parquet_types.h"
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+class TableFilter;
+
+using duckdb_apache::thrift::protocol::TProtocol;
+
+//! The split block bloom filter (SBBF) of a column chunk as defined by the Parquet format
+//! The filter consists of blocks of eight 32-bit words, every value sets one bit in each word of a single block
+class ParquetBloomFilter {
+public:
+	//! The size of a single block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 8 * sizeof(uint32_t);
+	//! We never write bloom filters that are larger than this
+	static constexpr const idx_t MAX_FILTER_SIZE = 1048576;
+	//! We size bloom filters for this false positive rate
+	static constexpr const double FALSE_POSITIVE_RATE = 0.01;
+	//! Columns with more distinct values than this do not get a bloom filter (they would exceed MAX_FILTER_SIZE)
+	static constexpr const idx_t MAX_DISTINCT_VALUES = 800000;
+
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+public:
+	//! Creates a bloom filter with room for the given amount of distinct values
+	static unique_ptr<ParquetBloomFilter> Create(idx_t distinct_count);
+	//! Reads a bloom filter (header and bitset) at the current location of the protocol
+	//! Returns nullptr if the bloom filter uses an unsupported algorithm, hash or compression
+	static unique_ptr<ParquetBloomFilter> Read(TProtocol &protocol);
+
+	//! Hashes the plain encoding of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	//! Hashes a constant in the plain encoding of the physical type of a column, returns false if not possible
+	static bool HashConstant(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema,
+	                         const Value &constant, uint64_t &result);
+
+	void Insert(uint64_t hash);
+	bool Contains(uint64_t hash) const;
+
+	//! Whether the equality or IN predicates in the filter cannot match any value in this bloom filter
+	bool FilterExcludes(const TableFilter &filter, const LogicalType &type,
+	                    const duckdb_parquet::format::SchemaElement &schema) const;
+	//! Whether the filter contains predicates that a bloom filter could exclude
+	static bool CanExclude(const TableFilter &filter);
+
+	//! Writes the bloom filter header followed by the bitset
+	void Write(TProtocol &protocol) const;
+
+	idx_t GetSize() const {
+		return num_bytes;
+	}
+
+private:
+	idx_t num_bytes;
+	unique_ptr<uint32_t[]> blocks;
+};
+
+} // namespace duckdb
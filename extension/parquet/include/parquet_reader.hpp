@@ -47,10 +47,19 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
 	idx_t group_offset;
+	//! The (sorted, non-overlapping) ranges of rows in the current group that are excluded by the page index
+	vector<ParquetRowRange> skip_ranges;
+	idx_t current_skip_range = 0;
 	unique_ptr<FileHandle> file_handle;
 	unique_ptr<ColumnReader> root_reader;
 	std::unique_ptr<duckdb_apache::thrift::protocol::TProtocol> thrift_file_proto;
@@ -162,6 +171,10 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page index of the filtered columns to find the rows of the current group that can be skipped
+	void PrepareSkipRanges(ParquetReaderScanState &state);
+	//! Whether the column reader reads the values of a single leaf column of the file as-is (without casts)
+	bool IsLeafColumnReader(const ColumnReader &column_reader, const vector<ColumnChunk> &columns);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
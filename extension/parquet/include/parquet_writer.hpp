@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -36,6 +37,15 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index and bloom filter of a column chunk - these are written after all row groups
+struct ParquetColumnChunkIndex {
+	idx_t row_group_idx = 0;
+	idx_t column_idx = 0;
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -64,7 +74,8 @@ public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
-	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold);
+	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
+	              bool write_page_index, bool write_bloom_filter);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -94,6 +105,14 @@ public:
 	double DictionaryCompressionRatioThreshold() const {
 		return dictionary_compression_ratio_threshold;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	bool WriteBloomFilter() const {
+		return write_bloom_filter;
+	}
+	//! Adds the page index and bloom filter of a column chunk of the row group that is being flushed
+	void AddColumnChunkIndex(unique_ptr<ParquetColumnChunkIndex> index);
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -110,6 +129,8 @@ private:
 	ChildFieldIDs field_ids;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
+	bool write_page_index;
+	bool write_bloom_filter;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -117,6 +138,10 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<unique_ptr<ParquetColumnChunkIndex>> column_chunk_indexes;
+
+private:
+	void WriteColumnChunkIndexes();
 };
 
 } // namespace duckdb
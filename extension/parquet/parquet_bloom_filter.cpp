@@ -0,0 +1,289 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#endif
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::Type;
+
+//! The salt values that map a hash to the bits in each of the words of a block
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes_p) : num_bytes(num_bytes_p) {
+	D_ASSERT(num_bytes >= BLOCK_SIZE && num_bytes % BLOCK_SIZE == 0);
+	blocks = unique_ptr<uint32_t[]>(new uint32_t[num_bytes / sizeof(uint32_t)]);
+	memset(blocks.get(), 0, num_bytes);
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Create(idx_t distinct_count) {
+	// the optimal amount of bits for a split block bloom filter with the target false positive rate
+	auto bits = -8.0 * double(distinct_count) / std::log(1.0 - std::pow(FALSE_POSITIVE_RATE, 1.0 / 8.0));
+	auto num_bytes = NextPowerOfTwo(MaxValue<idx_t>(idx_t(bits / 8.0), BLOCK_SIZE));
+	return make_uniq<ParquetBloomFilter>(MinValue<idx_t>(num_bytes, MAX_FILTER_SIZE));
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block_count = num_bytes / BLOCK_SIZE;
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = uint32_t(hash);
+	auto block = blocks.get() + block_idx * 8;
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::Contains(uint64_t hash) const {
+	auto block_count = num_bytes / BLOCK_SIZE;
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = uint32_t(hash);
+	auto block = blocks.get() + block_idx * 8;
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ParquetBloomFilter::HashConstant(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema,
+                                      const Value &constant, uint64_t &result) {
+	if (constant.IsNull() || constant.type() != type) {
+		return false;
+	}
+	// only types that are stored as-is in the physical type of the column are supported
+	// floating point values are not supported, as e.g. 0.0 and -0.0 compare equal but have different hashes
+	switch (schema.type) {
+	case Type::INT32: {
+		uint32_t value;
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			value = uint32_t(constant.GetValue<int64_t>());
+			break;
+		case LogicalTypeId::DATE:
+			value = uint32_t(constant.GetValue<date_t>().days);
+			break;
+		default:
+			return false;
+		}
+		result = Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case Type::INT64: {
+		uint64_t value;
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			value = uint64_t(constant.GetValue<int64_t>());
+			break;
+		case LogicalTypeId::UBIGINT:
+			value = constant.GetValue<uint64_t>();
+			break;
+		default:
+			return false;
+		}
+		result = Hash(const_data_ptr_cast(&value), sizeof(value));
+		return true;
+	}
+	case Type::BYTE_ARRAY: {
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		result = Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::FilterExcludes(const TableFilter &filter, const LogicalType &type,
+                                        const duckdb_parquet::format::SchemaElement &schema) const {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		uint64_t hash;
+		if (!HashConstant(type, schema, constant_filter.constant, hash)) {
+			return false;
+		}
+		return !Contains(hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			uint64_t hash;
+			if (!HashConstant(type, schema, value, hash) || Contains(hash)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterExcludes(*child_filter, type, schema)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterExcludes(*child_filter, type, schema)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::CanExclude(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (CanExclude(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!CanExclude(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Reads a union of empty structs (e.g. the algorithm of a bloom filter) and returns the id of the set field
+static int16_t ReadBloomFilterUnion(TProtocol &protocol) {
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int16_t result = 0;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		result = field_id;
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return result;
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	// read the BloomFilterHeader
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int32_t num_bytes = 0;
+	int16_t algorithm = 0;
+	int16_t hash = 0;
+	int16_t compression = 0;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == duckdb_apache::thrift::protocol::T_I32) {
+			protocol.readI32(num_bytes);
+		} else if (field_id == 2 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			algorithm = ReadBloomFilterUnion(protocol);
+		} else if (field_id == 3 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			hash = ReadBloomFilterUnion(protocol);
+		} else if (field_id == 4 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			compression = ReadBloomFilterUnion(protocol);
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	// we only support the BLOCK algorithm with the XXHASH hash and no compression - the only ones defined
+	if (algorithm != 1 || hash != 1 || compression != 1) {
+		return nullptr;
+	}
+	if (num_bytes < int32_t(BLOCK_SIZE) || num_bytes % BLOCK_SIZE != 0 || num_bytes > 128 * MAX_FILTER_SIZE) {
+		throw InvalidInputException("Malformed parquet file: invalid bloom filter size %d", num_bytes);
+	}
+	auto result = make_uniq<ParquetBloomFilter>(NumericCast<idx_t>(num_bytes));
+	protocol.getTransport()->read(data_ptr_cast(result->blocks.get()), NumericCast<uint32_t>(num_bytes));
+	return result;
+}
+
+//! Writes a union of empty structs with the given field set
+static void WriteBloomFilterUnion(TProtocol &protocol, const char *name, const char *field_name) {
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(field_name, duckdb_apache::thrift::protocol::T_STRUCT, 1);
+	protocol.writeStructBegin(field_name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol) const {
+	// write the BloomFilterHeader
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	protocol.writeI32(NumericCast<int32_t>(num_bytes));
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("algorithm", duckdb_apache::thrift::protocol::T_STRUCT, 2);
+	WriteBloomFilterUnion(protocol, "BloomFilterAlgorithm", "BLOCK");
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("hash", duckdb_apache::thrift::protocol::T_STRUCT, 3);
+	WriteBloomFilterUnion(protocol, "BloomFilterHash", "XXHASH");
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("compression", duckdb_apache::thrift::protocol::T_STRUCT, 4);
+	WriteBloomFilterUnion(protocol, "BloomFilterCompression", "UNCOMPRESSED");
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	// followed by the bitset
+	protocol.getTransport()->write(const_data_ptr_cast(blocks.get()), NumericCast<uint32_t>(num_bytes));
+}
+
+} // namespace duckdb
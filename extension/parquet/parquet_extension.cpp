@@ -134,6 +134,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	//! Dictionary compression is applied only if the compression ratio exceeds this threshold
 	double dictionary_compression_ratio_threshold = 1.0;
 
+	//! Whether to write the page index (ColumnIndex/OffsetIndex), which allows readers to skip individual pages
+	bool write_page_index = false;
+	//! Whether to write split block bloom filters for the column chunks
+	bool write_bloom_filter = false;
+
 	ChildFieldIDs field_ids;
 };
 
@@ -1005,10 +1010,17 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 				                      "dictionary compression");
 			}
 			bind_data->dictionary_compression_ratio_threshold = val;
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "write_bloom_filter") {
+			bind_data->write_bloom_filter = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && (bind_data->write_page_index || bind_data->write_bloom_filter)) {
+		throw NotImplementedException("WRITE_PAGE_INDEX and WRITE_BLOOM_FILTER are not supported for encrypted files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1033,7 +1045,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer =
 	    make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	                             parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
-	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold);
+	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
+	                             parquet_bind.write_page_index, parquet_bind.write_bloom_filter);
 	return std::move(global_state);
 }
 
@@ -1154,6 +1167,8 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	                                                                         bind_data.encryption_config, nullptr);
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
+	serializer.WritePropertyWithDefault<bool>(109, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<bool>(110, "write_bloom_filter", bind_data.write_bloom_filter, false);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1169,6 +1184,8 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	                                                                          data->encryption_config, nullptr);
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
+	deserializer.ReadPropertyWithDefault<bool>(109, "write_page_index", data->write_page_index, false);
+	deserializer.ReadPropertyWithDefault<bool>(110, "write_bloom_filter", data->write_bloom_filter, false);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -6,6 +6,7 @@
 #include "column_reader.hpp"
 #include "duckdb.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -16,6 +17,7 @@
 #include "templated_column_reader.hpp"
 #include "thrift_tools.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/pair.hpp"
@@ -25,6 +27,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -653,12 +656,28 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (stats) {
+				auto prune_result = filter.CheckStatistics(*stats);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
+				}
+			}
+			if (!skip_chunk && ParquetBloomFilter::CanExclude(filter) && !parquet_options.encryption_config &&
+			    IsLeafColumnReader(*column_reader, group.columns)) {
+				// the min/max statistics could not rule out equality predicates: try the bloom filter
+				auto &meta_data = group.columns[column_reader->FileIdx()].meta_data;
+				if (meta_data.__isset.bloom_filter_offset && meta_data.bloom_filter_offset > 0) {
+					auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+					trans.SetLocation(NumericCast<idx_t>(meta_data.bloom_filter_offset));
+					auto bloom_filter = ParquetBloomFilter::Read(*state.thrift_file_proto);
+					if (bloom_filter &&
+					    bloom_filter->FilterExcludes(filter, column_reader->Type(), column_reader->Schema())) {
+						skip_chunk = true;
+					}
+				}
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -672,6 +691,134 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::IsLeafColumnReader(const ColumnReader &column_reader, const vector<ColumnChunk> &columns) {
+	auto &s_ele = column_reader.Schema();
+	if (column_reader.FileIdx() >= columns.size() || column_reader.MaxRepeat() > 0 ||
+	    column_reader.Type().IsNested() || !s_ele.__isset.type) {
+		// generated (e.g. file_row_number), repeated or nested columns
+		return false;
+	}
+	// readers that cast the values (e.g. because of a schema) do not produce the type of the column in the file
+	return column_reader.Type() == DeriveLogicalType(s_ele);
+}
+
+//! Whether a filter can never be true for a NULL value
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterRejectsNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void ParquetReader::PrepareSkipRanges(ParquetReaderScanState &state) {
+	state.skip_ranges.clear();
+	state.current_skip_range = 0;
+	if (!reader_data.filters || parquet_options.encryption_config) {
+		return;
+	}
+	auto &group = GetGroup(state);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+
+	vector<ParquetRowRange> ranges;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto &filter = *filter_entry->second;
+		auto &column_reader = *root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (!IsLeafColumnReader(column_reader, group.columns)) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader.FileIdx()];
+		if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset ||
+		    column_chunk.column_index_offset <= 0 || column_chunk.offset_index_offset <= 0) {
+			continue;
+		}
+		duckdb_parquet::format::ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		Read(column_index, *state.thrift_file_proto);
+		duckdb_parquet::format::OffsetIndex offset_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		Read(offset_index, *state.thrift_file_proto);
+
+		auto &page_locations = offset_index.page_locations;
+		auto page_count = page_locations.size();
+		if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+		    column_index.max_values.size() != page_count) {
+			throw InvalidInputException("Malformed parquet file: column index and offset index do not match");
+		}
+		auto has_null_counts = column_index.__isset.null_counts && column_index.null_counts.size() == page_count;
+		auto rejects_nulls = FilterRejectsNulls(filter);
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			auto start = page_locations[page_idx].first_row_index;
+			auto end = page_idx + 1 < page_count ? page_locations[page_idx + 1].first_row_index : group.num_rows;
+			if (start < 0 || end < start || end > group.num_rows) {
+				throw InvalidInputException("Malformed parquet file: invalid first row index in offset index");
+			}
+			bool skip_page = false;
+			if (column_index.null_pages[page_idx]) {
+				skip_page = rejects_nulls;
+			} else {
+				// the column index contains the same min/max values as the statistics of the page would
+				duckdb_parquet::format::Statistics page_stats;
+				page_stats.__set_min_value(column_index.min_values[page_idx]);
+				page_stats.__set_max_value(column_index.max_values[page_idx]);
+				if (has_null_counts) {
+					page_stats.__set_null_count(column_index.null_counts[page_idx]);
+				}
+				auto stats = ParquetStatisticsUtils::TransformStatistics(column_reader, page_stats);
+				skip_page = stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+			if (skip_page && start < end) {
+				ranges.push_back(ParquetRowRange {NumericCast<idx_t>(start), NumericCast<idx_t>(end)});
+			}
+		}
+	}
+	if (ranges.empty()) {
+		return;
+	}
+	// a row can be skipped if any of the filters excludes it: merge the ranges of all columns
+	std::sort(ranges.begin(), ranges.end(),
+	          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+	for (auto &range : ranges) {
+		if (!state.skip_ranges.empty() && range.start <= state.skip_ranges.back().end) {
+			state.skip_ranges.back().end = MaxValue<idx_t>(state.skip_ranges.back().end, range.end);
+		} else {
+			state.skip_ranges.push_back(range);
+		}
+	}
+	if (state.skip_ranges[0].start == 0 && state.skip_ranges[0].end == group_rows) {
+		// all rows of the group are excluded
+		state.skip_ranges.clear();
+		state.group_offset = group_rows;
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -829,6 +976,24 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterInSet(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	SelectionVector sel(count);
+	idx_t approved_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_count++, i);
+		}
+	}
+	in_filter.Select(vdata, sel, approved_count);
+	parquet_filter_t in_mask;
+	for (idx_t i = 0; i < approved_count; i++) {
+		in_mask.set(sel.get_index(i));
+	}
+	filter_mask &= in_mask;
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -872,6 +1037,9 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		}
 		break;
 	}
+	case TableFilterType::IN_FILTER:
+		FilterInSet(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
 	case TableFilterType::IS_NOT_NULL:
 		FilterIsNotNull(v, filter_mask, count);
 		break;
@@ -928,6 +1096,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		auto &group = GetGroup(state);
+		if (state.group_offset != (idx_t)group.num_rows) {
+			PrepareSkipRanges(state);
+		} else {
+			state.skip_ranges.clear();
+		}
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -977,7 +1150,33 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	// skip over the rows that are excluded by the page index
+	idx_t group_rows = GetGroup(state).num_rows;
+	idx_t scan_end = group_rows;
+	while (state.current_skip_range < state.skip_ranges.size()) {
+		auto &range = state.skip_ranges[state.current_skip_range];
+		if (state.group_offset < range.start) {
+			scan_end = range.start;
+			break;
+		}
+		if (state.group_offset < range.end) {
+			if (range.end < group_rows) {
+				auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+				for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+					root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(range.end - state.group_offset);
+				}
+			}
+			state.group_offset = range.end;
+		}
+		state.current_skip_range++;
+	}
+	if (!state.skip_ranges.empty() && state.group_offset >= group_rows) {
+		// the remainder of the group is skipped: move on to the next group
+		result.SetCardinality(0);
+		return true;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, scan_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
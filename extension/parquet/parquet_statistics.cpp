@@ -285,8 +285,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -351,10 +351,12 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
-                             double dictionary_compression_ratio_threshold_p)
+                             double dictionary_compression_ratio_threshold_p, bool write_page_index_p,
+                             bool write_bloom_filter_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
-      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p) {
+      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      write_page_index(write_page_index_p), write_bloom_filter(write_bloom_filter_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -489,6 +491,12 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	prepared.heaps.clear();
 }
 
+void ParquetWriter::AddColumnChunkIndex(unique_ptr<ParquetColumnChunkIndex> index) {
+	// this is called while flushing a row group (with the lock held): the row group is appended afterwards
+	index->row_group_idx = file_meta_data.row_groups.size();
+	column_chunk_indexes.push_back(std::move(index));
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
@@ -501,7 +509,45 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::WriteColumnChunkIndexes() {
+	// the bloom filters are written first, followed by all column indexes and then all offset indexes
+	// this way, the page index of all row groups can be read with a single (small) read
+	for (auto &index : column_chunk_indexes) {
+		if (!index->bloom_filter) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index->row_group_idx].columns[index->column_idx];
+		auto offset = writer->GetTotalWritten();
+		index->bloom_filter->Write(*protocol);
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &index : column_chunk_indexes) {
+		if (!index->column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index->row_group_idx].columns[index->column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*index->column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &index : column_chunk_indexes) {
+		if (!index->offset_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index->row_group_idx].columns[index->column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*index->offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	column_chunk_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WriteColumnChunkIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -41,6 +41,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -71,6 +73,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::POSITIONAL_SCAN:
 		return "POSITIONAL_SCAN";
+	case PhysicalOperatorType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::INSERT:
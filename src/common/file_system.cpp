@@ -56,6 +56,7 @@ constexpr FileOpenFlags FileFlags::FILE_FLAGS_APPEND;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_PRIVATE;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
+constexpr FileOpenFlags FileFlags::FILE_FLAGS_IO_URING;
 
 void FileOpenFlags::Verify() {
 #ifdef DEBUG
@@ -361,6 +362,13 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Read (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		auto &request = requests[i];
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// This is not a required method. Derived FileSystems may optionally override/implement.
 	return false;
@@ -564,6 +572,10 @@ void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::ReadBatch(FileReadRequest *requests, idx_t count) {
+	file_system.ReadBatch(*this, requests, count);
+}
+
 void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
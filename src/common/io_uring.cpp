@@ -0,0 +1,264 @@
+#include "duckdb/common/io_uring.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_NO_IO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_IO_URING_AVAILABLE
+#endif
+#endif
+#endif
+
+#ifdef DUCKDB_IO_URING_AVAILABLE
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+// These system headers define macros that clash with names used throughout DuckDB in the unity build
+#undef BLOCK_SIZE
+#undef MAP_TYPE
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_IO_URING_AVAILABLE
+
+//! The memory mapped submission and completion queues of an io_uring
+struct IOUringState {
+	~IOUringState() {
+		if (sqes != MAP_FAILED) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring != MAP_FAILED) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+	int ring_fd = -1;
+	//! The amount of entries in the submission queue
+	idx_t entries = 0;
+
+	void *sq_ring = MAP_FAILED;
+	size_t sq_ring_size = 0;
+	void *cq_ring = MAP_FAILED;
+	size_t cq_ring_size = 0;
+	void *sqes = MAP_FAILED;
+	size_t sqes_size = 0;
+
+	uint32_t *sq_tail = nullptr;
+	uint32_t *sq_mask = nullptr;
+	uint32_t *sq_array = nullptr;
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	uint32_t *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+};
+
+//! Set if io_uring is not supported or not permitted: we do not retry in that case, but fall back to regular reads
+static atomic<bool> io_uring_unavailable {false};
+
+unique_ptr<IOUring> IOUring::TryCreate(idx_t entries) {
+	if (entries == 0 || io_uring_unavailable.load(std::memory_order_relaxed)) {
+		return nullptr;
+	}
+	io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	auto ring_fd = int(syscall(__NR_io_uring_setup, uint32_t(MinValue<idx_t>(entries, 4096)), &params));
+	if (ring_fd < 0) {
+		if (errno == ENOSYS || errno == EPERM || errno == EACCES) {
+			// the kernel does not support io_uring, or it is disabled (e.g. by a seccomp filter or by the
+			// io_uring_disabled sysctl) - other errors (e.g. EMFILE or ENOMEM) are transient and we retry later
+			io_uring_unavailable = true;
+		}
+		return nullptr;
+	}
+	auto state = make_uniq<IOUringState>();
+	state->ring_fd = ring_fd;
+	state->entries = params.sq_entries;
+
+	// map the submission and completion queues - newer kernels map both queues with a single mmap
+	state->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	state->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+	if (single_mmap) {
+		state->sq_ring_size = MaxValue(state->sq_ring_size, state->cq_ring_size);
+		state->cq_ring_size = state->sq_ring_size;
+	}
+	state->sq_ring = mmap(nullptr, state->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+	                      IORING_OFF_SQ_RING);
+	if (state->sq_ring == MAP_FAILED) {
+		return nullptr;
+	}
+	if (single_mmap) {
+		state->cq_ring = state->sq_ring;
+	} else {
+		state->cq_ring = mmap(nullptr, state->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		                      ring_fd, IORING_OFF_CQ_RING);
+		if (state->cq_ring == MAP_FAILED) {
+			return nullptr;
+		}
+	}
+	state->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+	state->sqes = mmap(nullptr, state->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+	                   IORING_OFF_SQES);
+	if (state->sqes == MAP_FAILED) {
+		return nullptr;
+	}
+
+	auto sq_ptr = static_cast<data_ptr_t>(state->sq_ring);
+	state->sq_tail = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.tail);
+	state->sq_mask = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.ring_mask);
+	state->sq_array = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.array);
+	auto cq_ptr = static_cast<data_ptr_t>(state->cq_ring);
+	state->cq_head = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.head);
+	state->cq_tail = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.tail);
+	state->cq_mask = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.ring_mask);
+	state->cqes = reinterpret_cast<io_uring_cqe *>(cq_ptr + params.cq_off.cqes);
+	return make_uniq<IOUring>(std::move(state));
+}
+
+//! Store the results of the completed reads, and return how many reads completed
+static idx_t ReapCompletions(IOUringState &ring, int64_t *results) {
+	idx_t completed = 0;
+	auto head = *ring.cq_head;
+	auto tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+	for (; head != tail; head++) {
+		auto &cqe = ring.cqes[head & *ring.cq_mask];
+		results[cqe.user_data] = cqe.res;
+		completed++;
+	}
+	__atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+	return completed;
+}
+
+//! Wait until the given amount of reads that are in flight have completed. This does not give up if waiting fails:
+//! the kernel still writes into the buffers of the reads, so they must have completed before we return.
+static void WaitForCompletions(IOUringState &ring, int64_t *results, idx_t in_flight) {
+	idx_t completed = ReapCompletions(ring, results);
+	while (completed < in_flight) {
+		auto ret = syscall(__NR_io_uring_enter, ring.ring_fd, 0U, 1U, IORING_ENTER_GETEVENTS, nullptr, 0);
+		if (ret < 0 && errno != EINTR) {
+			// we cannot block on the ring - poll the completion queue instead
+			TaskScheduler::YieldThread();
+		}
+		completed += ReapCompletions(ring, results);
+	}
+}
+
+void IOUring::Read(int fd, FileReadRequest *requests, idx_t count, int64_t *results) {
+	auto &ring = *state;
+	// we use readv instead of read as it is supported by all kernels that support io_uring
+	vector<iovec> iovecs(count);
+	for (idx_t i = 0; i < count; i++) {
+		iovecs[i].iov_base = requests[i].buffer;
+		iovecs[i].iov_len = requests[i].nr_bytes;
+	}
+	// submit the reads in chunks that fit in the submission queue
+	for (idx_t offset = 0; offset < count; offset += ring.entries) {
+		auto chunk_count = MinValue<idx_t>(count - offset, ring.entries);
+		auto mask = *ring.sq_mask;
+		auto tail = *ring.sq_tail;
+		for (idx_t i = offset; i < offset + chunk_count; i++) {
+			auto index = tail & mask;
+			auto &sqe = reinterpret_cast<io_uring_sqe *>(ring.sqes)[index];
+			memset(&sqe, 0, sizeof(io_uring_sqe));
+			sqe.opcode = IORING_OP_READV;
+			sqe.fd = fd;
+			sqe.off = requests[i].location;
+			sqe.addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+			sqe.len = 1;
+			sqe.user_data = i;
+			ring.sq_array[index] = index;
+			tail++;
+		}
+		// publish the new entries to the kernel
+		__atomic_store_n(ring.sq_tail, tail, __ATOMIC_RELEASE);
+
+		idx_t submitted = 0;
+		idx_t completed = 0;
+		while (completed < chunk_count) {
+			auto to_submit = uint32_t(chunk_count - submitted);
+			auto ret = syscall(__NR_io_uring_enter, ring.ring_fd, to_submit, 1U, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (ret < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				auto error = errno;
+				// take back the entries that were not submitted, so the next batch does not submit them
+				__atomic_store_n(ring.sq_tail, tail - uint32_t(chunk_count - submitted), __ATOMIC_RELEASE);
+				// the reads that are in flight write into the buffers - wait for all of them before throwing
+				WaitForCompletions(ring, results, submitted - completed);
+				throw IOException("Could not submit reads to io_uring: %s", strerror(error));
+			}
+			submitted += idx_t(ret);
+			completed += ReapCompletions(ring, results);
+		}
+	}
+}
+
+#else
+
+struct IOUringState {};
+
+unique_ptr<IOUring> IOUring::TryCreate(idx_t entries) {
+	return nullptr;
+}
+
+void IOUring::Read(int fd, FileReadRequest *requests, idx_t count, int64_t *results) {
+	throw NotImplementedException("io_uring is not supported on this platform");
+}
+
+#endif
+
+IOUring::IOUring(unique_ptr<IOUringState> state_p) : state(std::move(state_p)) {
+}
+
+IOUring::~IOUring() {
+}
+
+//! The rings that are not in use by any thread, shared by all file systems of the process
+struct IOUringPool {
+	mutex lock;
+	vector<unique_ptr<IOUring>> rings;
+};
+
+static IOUringPool &GetIOUringPool() {
+	static IOUringPool pool;
+	return pool;
+}
+
+unique_ptr<IOUring> IOUring::Acquire() {
+	auto &pool = GetIOUringPool();
+	{
+		lock_guard<mutex> guard(pool.lock);
+		if (!pool.rings.empty()) {
+			auto ring = std::move(pool.rings.back());
+			pool.rings.pop_back();
+			return ring;
+		}
+	}
+	return TryCreate(RING_ENTRIES);
+}
+
+void IOUring::Release(unique_ptr<IOUring> ring) {
+	auto &pool = GetIOUringPool();
+	lock_guard<mutex> guard(pool.lock);
+	if (pool.rings.size() < MAX_IDLE_RINGS) {
+		pool.rings.push_back(std::move(ring));
+	}
+}
+
+} // namespace duckdb
@@ -4,11 +4,13 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -128,13 +130,18 @@ bool LocalFileSystem::IsPipe(const string &filename, optional_ptr<FileOpener> op
 
 struct UnixFileHandle : public FileHandle {
 public:
-	UnixFileHandle(FileSystem &file_system, string path, int fd) : FileHandle(file_system, std::move(path)), fd(fd) {
+	UnixFileHandle(FileSystem &file_system, string path, int fd, bool direct_io, bool io_uring)
+	    : FileHandle(file_system, std::move(path)), fd(fd), direct_io(direct_io), io_uring(io_uring) {
 	}
 	~UnixFileHandle() override {
 		UnixFileHandle::Close();
 	}
 
 	int fd;
+	//! Whether or not the file was opened with O_DIRECT, which requires sector-aligned reads and writes
+	bool direct_io;
+	//! Whether or not batched reads are submitted through io_uring
+	bool io_uring;
 
 public:
 	void Close() override {
@@ -294,7 +301,8 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 	} else if (open_read) {
 		open_flags = O_RDONLY;
 	} else if (open_write) {
-		open_flags = O_WRONLY;
+		// unaligned direct I/O writes read the sectors they partially overwrite, so they need a readable file
+		open_flags = flags.DirectIO() ? O_RDWR : O_WRONLY;
 	} else {
 		throw InternalException("READ, WRITE or both should be specified when opening a file");
 	}
@@ -334,6 +342,12 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 
 	// Open the file
 	int fd = open(path.c_str(), open_flags, filesec);
+	bool direct_io = flags.DirectIO() && O_DIRECT != 0;
+	if (fd == -1 && errno == EINVAL && direct_io) {
+		// the file system does not support direct I/O (e.g., tmpfs): fall back to going through the page cache
+		direct_io = false;
+		fd = open(path.c_str(), open_flags & ~O_DIRECT, filesec);
+	}
 
 	if (fd == -1) {
 		if (flags.ReturnNullIfNotExists() && errno == ENOENT) {
@@ -389,7 +403,7 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 			}
 		}
 	}
-	return make_uniq<UnixFileHandle>(*this, path, fd);
+	return make_uniq<UnixFileHandle>(*this, path, fd, direct_io, flags.UseIOUring());
 }
 
 void LocalFileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
@@ -411,7 +425,93 @@ idx_t LocalFileSystem::GetFilePointer(FileHandle &handle) {
 	return UnsafeNumericCast<idx_t>(position);
 }
 
+//===--------------------------------------------------------------------===//
+// Direct IO
+//===--------------------------------------------------------------------===//
+static bool IsDirectIOAligned(const void *buffer, idx_t nr_bytes, idx_t location) {
+	return ValueIsAligned<uintptr_t, Storage::SECTOR_SIZE>(reinterpret_cast<uintptr_t>(buffer)) &&
+	       ValueIsAligned<idx_t, Storage::SECTOR_SIZE>(nr_bytes) &&
+	       ValueIsAligned<idx_t, Storage::SECTOR_SIZE>(location);
+}
+
+//! A sector-aligned buffer that holds the sectors that an unaligned read or write of a direct I/O file touches
+struct DirectIOBuffer {
+	DirectIOBuffer(idx_t nr_bytes, idx_t location)
+	    : start(AlignValueFloor<idx_t, Storage::SECTOR_SIZE>(location)),
+	      size(AlignValue<idx_t, Storage::SECTOR_SIZE>(location + nr_bytes) - start) {
+		void *pointer;
+		if (posix_memalign(&pointer, Storage::SECTOR_SIZE, size) != 0) {
+			throw std::bad_alloc();
+		}
+		data = data_ptr_cast(pointer);
+	}
+	~DirectIOBuffer() {
+		free(data);
+	}
+
+	//! The location in the file and the size of the sectors
+	idx_t start;
+	idx_t size;
+	data_ptr_t data;
+};
+
+//! Read (part of) the sectors of the buffer, returns the amount of bytes that were read before the end of the file
+static idx_t ReadDirectIOSectors(FileHandle &handle, DirectIOBuffer &sectors, idx_t offset, idx_t nr_bytes) {
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	idx_t total_read = 0;
+	while (total_read < nr_bytes) {
+		auto location = sectors.start + offset + total_read;
+		int64_t bytes_read = pread(fd, sectors.data + offset + total_read, nr_bytes - total_read,
+		                           UnsafeNumericCast<off_t>(location));
+		if (bytes_read == -1) {
+			throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(errno)}}, handle.path,
+			                  strerror(errno));
+		}
+		if (bytes_read == 0) {
+			// end of file
+			break;
+		}
+		total_read += idx_t(bytes_read);
+	}
+	return total_read;
+}
+
+static void ReadUnalignedDirectIO(FileHandle &handle, void *buffer, idx_t nr_bytes, idx_t location) {
+	DirectIOBuffer sectors(nr_bytes, location);
+	auto bytes_read = ReadDirectIOSectors(handle, sectors, 0, sectors.size);
+	auto offset = location - sectors.start;
+	if (bytes_read < offset + nr_bytes) {
+		throw IOException(
+		    "Could not read enough bytes from file \"%s\": attempted to read %llu bytes from location %llu",
+		    handle.path, nr_bytes, location);
+	}
+	memcpy(buffer, sectors.data + offset, nr_bytes);
+}
+
+static void WriteUnalignedDirectIO(FileHandle &handle, void *buffer, idx_t nr_bytes, idx_t location) {
+	DirectIOBuffer sectors(nr_bytes, location);
+	// read the first and the last sector if they are only partially overwritten
+	auto offset = location - sectors.start;
+	auto end = offset + nr_bytes;
+	auto last_sector = sectors.size - Storage::SECTOR_SIZE;
+	if (offset > 0) {
+		auto bytes_read = ReadDirectIOSectors(handle, sectors, 0, Storage::SECTOR_SIZE);
+		memset(sectors.data + bytes_read, 0, Storage::SECTOR_SIZE - bytes_read);
+	}
+	if (end < sectors.size && (last_sector > 0 || offset == 0)) {
+		auto bytes_read = ReadDirectIOSectors(handle, sectors, last_sector, Storage::SECTOR_SIZE);
+		memset(sectors.data + last_sector + bytes_read, 0, Storage::SECTOR_SIZE - bytes_read);
+	}
+	memcpy(sectors.data + offset, buffer, nr_bytes);
+	handle.Write(sectors.data, sectors.size, sectors.start);
+}
+
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (handle.Cast<UnixFileHandle>().direct_io && !IsDirectIOAligned(buffer, idx_t(nr_bytes), location)) {
+		// O_DIRECT requires aligned reads: read the sectors that contain the data into an aligned buffer
+		ReadUnalignedDirectIO(handle, buffer, idx_t(nr_bytes), location);
+		return;
+	}
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	auto read_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
@@ -432,6 +532,39 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) {
+	auto &unix_handle = handle.Cast<UnixFileHandle>();
+	bool aligned = true;
+	if (unix_handle.direct_io) {
+		for (idx_t i = 0; i < count && aligned; i++) {
+			aligned = IsDirectIOAligned(requests[i].buffer, requests[i].nr_bytes, requests[i].location);
+		}
+	}
+	auto ring = unix_handle.io_uring && count > 1 && aligned ? IOUring::Acquire() : nullptr;
+	if (!ring) {
+		FileSystem::ReadBatch(handle, requests, count);
+		return;
+	}
+	vector<int64_t> results(count);
+	// if the reads could not be submitted the ring is not reused - Read has waited for the reads that were in flight
+	ring->Read(unix_handle.fd, requests, count, results.data());
+	IOUring::Release(std::move(ring));
+	for (idx_t i = 0; i < count; i++) {
+		auto &request = requests[i];
+		auto bytes_read = results[i];
+		if (bytes_read < 0) {
+			throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(-bytes_read)}},
+			                  handle.path, strerror(int(-bytes_read)));
+		}
+		if (idx_t(bytes_read) < request.nr_bytes) {
+			// short read: read the remainder with a regular read
+			auto remaining = UnsafeNumericCast<int64_t>(request.nr_bytes - idx_t(bytes_read));
+			Read(handle, char_ptr_cast(request.buffer) + bytes_read, remaining,
+			     request.location + idx_t(bytes_read));
+		}
+	}
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -443,6 +576,11 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 }
 
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (handle.Cast<UnixFileHandle>().direct_io && !IsDirectIOAligned(buffer, idx_t(nr_bytes), location)) {
+		// O_DIRECT requires aligned writes: write all sectors that contain the data from an aligned buffer
+		WriteUnalignedDirectIO(handle, buffer, idx_t(nr_bytes), location);
+		return;
+	}
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	auto write_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
@@ -906,6 +1044,10 @@ static int64_t FSWrite(FileHandle &handle, HANDLE hFile, void *buffer, int64_t n
 	return bytes_written;
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) {
+	FileSystem::ReadBatch(handle, requests, count);
+}
+
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto bytes_written = FSWrite(handle, hFile, buffer, nr_bytes, location);
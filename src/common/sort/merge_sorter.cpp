@@ -10,14 +10,24 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 
 void MergeSorter::PerformInMergeRound() {
 	while (true) {
+		bool k_way;
 		{
 			lock_guard<mutex> pair_guard(state.lock);
 			if (state.pair_idx == state.num_pairs) {
 				break;
 			}
-			GetNextPartition();
+			k_way = state.merge_fan_in > 2;
+			if (k_way) {
+				GetNextKWayPartition();
+			} else {
+				GetNextPartition();
+			}
+		}
+		if (k_way) {
+			MergeKWayPartition();
+		} else {
+			MergePartition();
 		}
-		MergePartition();
 	}
 }
 
@@ -141,7 +151,10 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	if (r_idx < state.r_start) {
 		return 1;
 	}
+	return CompareEntries(l, r, l_idx, r_idx);
+}
 
+int MergeSorter::CompareEntries(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
 
@@ -660,4 +673,303 @@ void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count,
 	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
 }
 
+void MergeSorter::GetNextKWayPartition() {
+	// Create result block
+	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	// Determine which blocks must be merged
+	const idx_t group_start = state.pair_idx * state.merge_fan_in;
+	const idx_t group_end = MinValue(group_start + state.merge_fan_in, state.sorted_blocks.size());
+	const idx_t run_count = group_end - group_start;
+	D_ASSERT(run_count >= 2 && run_count <= SortConstants::MERGE_FAN_IN);
+	if (state.run_starts.empty()) {
+		state.run_starts.resize(run_count, 0);
+	}
+	vector<idx_t> counts;
+	idx_t total_start = 0;
+	idx_t total_count = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		counts.push_back(state.sorted_blocks[group_start + run_idx]->Count());
+		total_start += state.run_starts[run_idx];
+		total_count += counts.back();
+	}
+	// Compute the work that this thread must do using Merge Path
+	vector<idx_t> ends;
+	if (total_start + state.block_capacity < total_count) {
+		vector<unique_ptr<SBScanState>> scans;
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			scans.push_back(make_uniq<SBScanState>(buffer_manager, state));
+			scans.back()->sb = state.sorted_blocks[group_start + run_idx].get();
+		}
+		GetKWaySplit(scans, counts, total_start + state.block_capacity, ends);
+	} else {
+		ends = counts;
+	}
+	// Create slices of the data that this thread must merge
+	runs.clear();
+	run_inputs.clear();
+	bool group_done = true;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		runs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		auto &run = *runs.back();
+		run.SetIndices(0, 0);
+		auto &sorted_block = *state.sorted_blocks[group_start + run_idx];
+		run_inputs.push_back(sorted_block.CreateSlice(state.run_starts[run_idx], ends[run_idx], run.entry_idx));
+		run.sb = run_inputs.back().get();
+		state.run_starts[run_idx] = ends[run_idx];
+		group_done = group_done && ends[run_idx] == counts[run_idx];
+	}
+	// Update global state
+	if (group_done) {
+		// Delete references to previous group
+		for (idx_t block_idx = group_start; block_idx < group_end; block_idx++) {
+			state.sorted_blocks[block_idx] = nullptr;
+		}
+		// Advance group
+		state.pair_idx++;
+		state.run_starts.clear();
+	}
+}
+
+void MergeSorter::GetKWaySplit(vector<unique_ptr<SBScanState>> &scans, const vector<idx_t> &counts, const idx_t rank,
+                               vector<idx_t> &ends) {
+	// Rows are ordered by their sorting key, ties are ordered by the index of their run
+	// For each run, binary search for the first row that is not among the 'rank' smallest rows of the group
+	// Rows that come before the start of the runs have already been merged, so the search starts there
+	const idx_t run_count = counts.size();
+	ends.resize(run_count);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		idx_t lower = state.run_starts[run_idx];
+		idx_t upper = counts[run_idx];
+		while (lower < upper) {
+			const idx_t middle = lower + (upper - lower) / 2;
+			// Count the rows of the group that come before this row
+			idx_t middle_rank = middle;
+			for (idx_t other_idx = 0; other_idx < run_count; other_idx++) {
+				if (other_idx == run_idx) {
+					continue;
+				}
+				idx_t other_lower = state.run_starts[other_idx];
+				idx_t other_upper = counts[other_idx];
+				while (other_lower < other_upper) {
+					const idx_t other_middle = other_lower + (other_upper - other_lower) / 2;
+					const int comp_res = CompareEntries(*scans[other_idx], *scans[run_idx], other_middle, middle);
+					if (comp_res < 0 || (comp_res == 0 && other_idx < run_idx)) {
+						other_lower = other_middle + 1;
+					} else {
+						other_upper = other_middle;
+					}
+				}
+				middle_rank += other_lower;
+			}
+			if (middle_rank < rank) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
+			}
+		}
+		ends[run_idx] = lower;
+	}
+#ifdef DEBUG
+	idx_t total_end = 0;
+	for (auto &end : ends) {
+		total_end += end;
+	}
+	D_ASSERT(total_end == rank);
+#endif
+}
+
+void MergeSorter::MergeKWayPartition() {
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite();
+	// Initialize array to store merge data
+	idx_t sources[STANDARD_VECTOR_SIZE];
+	// Merge loop
+	while (true) {
+		idx_t remaining = 0;
+		for (auto &run : runs) {
+			remaining += run->Remaining();
+		}
+		if (remaining == 0) {
+			// Done
+			break;
+		}
+		const idx_t next = MinValue(remaining, (idx_t)STANDARD_VECTOR_SIZE);
+		ComputeKWayMerge(next, sources);
+		// Actually merge the data (radix, blob, and payload)
+		MergeKWayRadix(next, sources);
+		if (!sort_layout.all_constant) {
+			MergeKWayData(*result->blob_sorting_data, SortedDataType::BLOB, next, sources, true);
+			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
+		}
+		MergeKWayData(*result->payload_data, SortedDataType::PAYLOAD, next, sources, false);
+		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+	}
+}
+
+//! Moves a run to the next block (if needed) and pins it, returns nullptr if the run is exhausted
+static data_ptr_t PinKWayRun(SBScanState &run, const bool pin_blob) {
+	auto &blocks = run.sb->radix_sorting_data;
+	while (run.block_idx < blocks.size() && run.entry_idx == blocks[run.block_idx]->count) {
+		run.block_idx++;
+		run.entry_idx = 0;
+	}
+	if (run.block_idx == blocks.size()) {
+		return nullptr;
+	}
+	run.PinRadix(run.block_idx);
+	if (pin_blob) {
+		run.PinData(*run.sb->blob_sorting_data);
+	}
+	return run.RadixPtr();
+}
+
+bool MergeSorter::KWayRunIsSmaller(const idx_t l, const idx_t r, const data_ptr_t run_ptrs[]) {
+	if (l == DConstants::INVALID_INDEX || !run_ptrs[l]) {
+		return false;
+	}
+	if (r == DConstants::INVALID_INDEX || !run_ptrs[r]) {
+		return true;
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(run_ptrs[l], run_ptrs[r], sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(*runs[l], *runs[r], run_ptrs[l], run_ptrs[r], sort_layout, state.external);
+	}
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+void MergeSorter::ComputeKWayMerge(const idx_t &count, idx_t sources[]) {
+	const idx_t run_count = runs.size();
+	const bool pin_blob = !sort_layout.all_constant;
+	// Save indices to restore afterwards
+	idx_t block_idx_before[SortConstants::MERGE_FAN_IN];
+	idx_t entry_idx_before[SortConstants::MERGE_FAN_IN];
+	data_ptr_t run_ptrs[SortConstants::MERGE_FAN_IN];
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		block_idx_before[run_idx] = runs[run_idx]->block_idx;
+		entry_idx_before[run_idx] = runs[run_idx]->entry_idx;
+		run_ptrs[run_idx] = PinKWayRun(*runs[run_idx], pin_blob);
+	}
+	// Build a winner tree with a leaf for each run, every node holds the run with the smallest row below it
+	idx_t leaf_count = 1;
+	while (leaf_count < run_count) {
+		leaf_count *= 2;
+	}
+	winner_tree.assign(2 * leaf_count, DConstants::INVALID_INDEX);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		winner_tree[leaf_count + run_idx] = run_idx;
+	}
+	for (idx_t node = leaf_count - 1; node > 0; node--) {
+		const auto &l = winner_tree[2 * node];
+		const auto &r = winner_tree[2 * node + 1];
+		winner_tree[node] = KWayRunIsSmaller(l, r, run_ptrs) ? l : r;
+	}
+	// Compute the merge of the next 'count' tuples
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t winner = winner_tree[1];
+		D_ASSERT(winner != DConstants::INVALID_INDEX && run_ptrs[winner]);
+		sources[i] = winner;
+		// Advance the winning run, and replay the comparisons on the path from its leaf to the root
+		auto &run = *runs[winner];
+		run.entry_idx++;
+		run_ptrs[winner] = PinKWayRun(run, pin_blob);
+		for (idx_t node = (leaf_count + winner) / 2; node > 0; node /= 2) {
+			const auto &l = winner_tree[2 * node];
+			const auto &r = winner_tree[2 * node + 1];
+			winner_tree[node] = KWayRunIsSmaller(l, r, run_ptrs) ? l : r;
+		}
+	}
+	// Reset block indices
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		runs[run_idx]->SetIndices(block_idx_before[run_idx], entry_idx_before[run_idx]);
+	}
+}
+
+void MergeSorter::MergeKWayRadix(const idx_t &count, const idx_t sources[]) {
+	const idx_t run_count = runs.size();
+	// Save indices to restore afterwards
+	idx_t block_idx_before[SortConstants::MERGE_FAN_IN];
+	idx_t entry_idx_before[SortConstants::MERGE_FAN_IN];
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		block_idx_before[run_idx] = runs[run_idx]->block_idx;
+		entry_idx_before[run_idx] = runs[run_idx]->entry_idx;
+	}
+
+	RowDataBlock *result_block = result->radix_sorting_data.back().get();
+	auto result_handle = buffer_manager.Pin(result_block->block);
+	data_ptr_t result_ptr = result_handle.Ptr() + result_block->count * sort_layout.entry_size;
+	D_ASSERT(result_block->count + count <= result_block->capacity);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto &run = *runs[sources[i]];
+		auto &blocks = run.sb->radix_sorting_data;
+		// Move to the next block (if needed)
+		while (run.entry_idx == blocks[run.block_idx]->count) {
+			// Delete reference to previous block
+			blocks[run.block_idx]->block = nullptr;
+			// Advance block
+			run.block_idx++;
+			run.entry_idx = 0;
+		}
+		run.PinRadix(run.block_idx);
+		FastMemcpy(result_ptr, run.RadixPtr(), sort_layout.entry_size);
+		result_ptr += sort_layout.entry_size;
+		run.entry_idx++;
+	}
+	result_block->count += count;
+	// Reset block indices
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		runs[run_idx]->SetIndices(block_idx_before[run_idx], entry_idx_before[run_idx]);
+	}
+}
+
+void MergeSorter::MergeKWayData(SortedData &result_data, SortedDataType type, const idx_t &count,
+                                const idx_t sources[], bool reset_indices) {
+	const idx_t run_count = runs.size();
+	// Save indices to restore afterwards
+	idx_t block_idx_before[SortConstants::MERGE_FAN_IN];
+	idx_t entry_idx_before[SortConstants::MERGE_FAN_IN];
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		block_idx_before[run_idx] = runs[run_idx]->block_idx;
+		entry_idx_before[run_idx] = runs[run_idx]->entry_idx;
+	}
+
+	// K-way merges are only done in-memory, so we do not need to touch the heap
+	const auto &layout = result_data.layout;
+	D_ASSERT(layout.AllConstant() || !state.external);
+	const idx_t row_width = layout.GetRowWidth();
+
+	// Result rows to write to
+	RowDataBlock *result_data_block = result_data.data_blocks.back().get();
+	auto result_data_handle = buffer_manager.Pin(result_data_block->block);
+	data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block->count * row_width;
+	D_ASSERT(result_data_block->count + count <= result_data_block->capacity);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto &run = *runs[sources[i]];
+		auto &run_data = type == SortedDataType::BLOB ? *run.sb->blob_sorting_data : *run.sb->payload_data;
+		// Move to the next block (if needed)
+		while (run.entry_idx == run_data.data_blocks[run.block_idx]->count) {
+			// Delete reference to previous block
+			run_data.data_blocks[run.block_idx]->block = nullptr;
+			// Advance block
+			run.block_idx++;
+			run.entry_idx = 0;
+		}
+		run.PinData(run_data);
+		FastMemcpy(result_data_ptr, run.DataPtr(run_data), row_width);
+		result_data_ptr += row_width;
+		run.entry_idx++;
+	}
+	result_data_block->count += count;
+	if (reset_indices) {
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			runs[run_idx]->SetIndices(block_idx_before[run_idx], entry_idx_before[run_idx]);
+		}
+	}
+}
+
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -71,14 +72,15 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+				// Short strings are normalized entirely so that ties never have to be broken using the heap
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
+				if (col_size > SortConstants::MAX_NORMALIZED_STRING_SIZE) {
+					col_size = SortConstants::STRING_PREFIX_SIZE;
 				} else {
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_PREFIX_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -363,7 +365,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -429,21 +431,38 @@ void GlobalSortState::PrepareMergePhase() {
 	}
 }
 
+idx_t GlobalSortState::GetMaximumMergeFanIn() {
+	// Every thread that merges a group pins a block of each sorted data for every block in the group
+	// Merge only as many blocks at once as fit in a quarter of the memory when all threads are merging
+	auto &scheduler = TaskScheduler::GetScheduler(buffer_manager.GetDatabase());
+	auto threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto row_width = sort_layout.entry_size + payload_layout.GetRowWidth();
+	if (!sort_layout.all_constant) {
+		row_width += sort_layout.blob_layout.GetRowWidth();
+	}
+	auto pinned_size = MaxValue<idx_t>(threads * block_capacity * row_width, 1);
+	return MinValue<idx_t>(buffer_manager.GetQueryMaxMemory() / 4 / pinned_size, SortConstants::MERGE_FAN_IN);
+}
+
 void GlobalSortState::InitializeMergeRound() {
 	D_ASSERT(sorted_blocks_temp.empty());
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// In-memory sorts merge groups of blocks at once, this reduces the number of times all data is copied
+	// External sorts merge pairs of blocks, as every block that is merged at once must be pinned
+	merge_fan_in = external ? 2 : MaxValue<idx_t>(MinValue(sorted_blocks.size(), GetMaximumMergeFanIn()), 2);
+	// A group of only one block - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
+	num_pairs = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
 	l_start = 0;
 	r_start = 0;
+	run_starts.clear();
 	// Allocate room for merge results
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
 		sorted_blocks_temp.emplace_back();
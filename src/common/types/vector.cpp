@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/pair.hpp"
@@ -228,6 +229,8 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
 		auto &current_sel = DictionaryVector::SelVector(*this);
+		auto dictionary_size = DictionaryVector::DictionarySize(*this);
+		auto dictionary_id = DictionaryVector::DictionaryId(*this);
 		auto sliced_dictionary = current_sel.Slice(sel, count);
 		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
@@ -236,6 +239,11 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 			Vector new_child(child_vector);
 			new_child.auxiliary = make_buffer<VectorStructBuffer>(new_child, sel, count);
 			auxiliary = make_buffer<VectorChildBuffer>(std::move(new_child));
+		} else if (dictionary_size.IsValid()) {
+			// the sliced vector still references the same dictionary
+			auto &dict_buffer = buffer->Cast<DictionaryBuffer>();
+			dict_buffer.SetDictionarySize(dictionary_size.GetIndex());
+			dict_buffer.SetDictionaryId(dictionary_id);
 		}
 		return;
 	}
@@ -266,7 +274,14 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
-			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
+			auto &cached_buffer = entry->second->Cast<DictionaryBuffer>();
+			auto dict_buffer = make_buffer<DictionaryBuffer>(cached_buffer.GetSelVector());
+			auto dictionary_size = cached_buffer.GetDictionarySize();
+			if (dictionary_size.IsValid()) {
+				dict_buffer->SetDictionarySize(dictionary_size.GetIndex());
+				dict_buffer->SetDictionaryId(cached_buffer.GetDictionaryId());
+			}
+			this->buffer = std::move(dict_buffer);
 			vector_type = VectorType::DICTIONARY_VECTOR;
 		} else {
 			Slice(sel, count);
@@ -277,6 +292,21 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 	}
 }
 
+void Vector::Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count) {
+	D_ASSERT(dict.GetVectorType() == VectorType::FLAT_VECTOR);
+	Reference(dict);
+	Slice(sel, count);
+	if (GetVectorType() != VectorType::DICTIONARY_VECTOR || GetType().InternalType() == PhysicalType::STRUCT) {
+		return;
+	}
+	buffer->Cast<DictionaryBuffer>().SetDictionarySize(dictionary_size);
+}
+
+idx_t DictionaryVector::GenerateDictionaryId() {
+	static atomic<idx_t> next_dictionary_id {0};
+	return ++next_dictionary_id;
+}
+
 void Vector::Initialize(bool zero_data, idx_t capacity) {
 	auxiliary.reset();
 	validity.Reset();
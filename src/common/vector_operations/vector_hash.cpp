@@ -307,7 +307,33 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 	}
 }
 
+static void DictionaryHash(Vector &input, Vector &result, idx_t dictionary_size, idx_t count) {
+	// hash every entry of the dictionary once, then look up the hashes through the selection vector
+	auto &dictionary = DictionaryVector::Child(input);
+	Vector dictionary_hashes(LogicalType::HASH, dictionary_size);
+	HashTypeSwitch<false>(dictionary, dictionary_hashes, nullptr, dictionary_size);
+
+	UnifiedVectorFormat hdata;
+	dictionary_hashes.ToUnifiedFormat(dictionary_size, hdata);
+	auto dictionary_hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	auto &sel = DictionaryVector::SelVector(input);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<hash_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = dictionary_hash_data[hdata.sel->get_index(sel.get_index(i))];
+	}
+}
+
 void VectorOperations::Hash(Vector &input, Vector &result, idx_t count) {
+	if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(input);
+		if (dictionary_size.IsValid() && dictionary_size.GetIndex() * 2 <= count) {
+			// the dictionary is (much) smaller than the vector: only hash the distinct values
+			DictionaryHash(input, result, dictionary_size.GetIndex(), count);
+			return;
+		}
+	}
 	HashTypeSwitch<false>(input, result, nullptr, count);
 }
 
@@ -54,6 +54,10 @@ void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
 
+void VirtualFileSystem::ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) {
+	handle.file_system.ReadBatch(handle, requests, count);
+}
+
 int64_t VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return handle.file_system.Read(handle, buffer, nr_bytes);
 }
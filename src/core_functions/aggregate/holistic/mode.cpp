@@ -52,6 +52,14 @@ struct ModeState {
 	};
 	using Counts = unordered_map<KEY_TYPE, ModeAttr>;
 
+	//! The distinct values of a window partition, numbered so that frames can be counted without hashing the values
+	struct DenseKeys {
+		//! The id of the value of every included row
+		vector<uint32_t> ids;
+		//! The value of every id
+		vector<KEY_TYPE> keys;
+	};
+
 	ModeState() {
 	}
 
@@ -62,6 +70,16 @@ struct ModeState {
 	bool valid = false;
 	size_t count = 0;
 
+	//	Windowed MODE with numbered values
+	//! The numbered values of the partition (global state)
+	unique_ptr<DenseKeys> dense_keys;
+	//! The numbered values that the frames are counted with (local state)
+	optional_ptr<const DenseKeys> dense;
+	//! The counts of the frame by id
+	vector<ModeAttr> dense_counts;
+	//! The ids that were counted since the last reset
+	vector<uint32_t> dense_touched;
+
 	~ModeState() {
 		if (frequency_map) {
 			delete frequency_map;
@@ -72,15 +90,52 @@ struct ModeState {
 	}
 
 	void Reset() {
-		Counts empty;
-		frequency_map->swap(empty);
+		if (dense) {
+			for (const auto id : dense_touched) {
+				dense_counts[id] = ModeAttr();
+			}
+			dense_touched.clear();
+		} else {
+			Counts empty;
+			frequency_map->swap(empty);
+		}
 		nonzero = 0;
 		count = 0;
 		valid = false;
 	}
 
-	void ModeAdd(const KEY_TYPE &key, idx_t row) {
-		auto &attr = (*frequency_map)[key];
+	//! The number of values that were counted since the last reset
+	size_t Size() const {
+		return dense ? dense_touched.size() : frequency_map->size();
+	}
+
+	template <class INPUT_TYPE>
+	void ModeAdd(const INPUT_TYPE *data, idx_t row) {
+		if (dense) {
+			const auto id = dense->ids[row];
+			auto &attr = dense_counts[id];
+			if (attr.first_row == NumericLimits<idx_t>::Maximum()) {
+				dense_touched.emplace_back(id);
+			}
+			ModeAdd(attr, dense->keys[id], row);
+		} else {
+			const auto key = KEY_TYPE(data[row]);
+			ModeAdd((*frequency_map)[key], key, row);
+		}
+	}
+
+	template <class INPUT_TYPE>
+	void ModeRm(const INPUT_TYPE *data, idx_t row) {
+		if (dense) {
+			const auto id = dense->ids[row];
+			ModeRm(dense_counts[id], dense->keys[id]);
+		} else {
+			const auto key = KEY_TYPE(data[row]);
+			ModeRm((*frequency_map)[key], key);
+		}
+	}
+
+	void ModeAdd(ModeAttr &attr, const KEY_TYPE &key, idx_t row) {
 		auto new_count = (attr.count += 1);
 		if (new_count == 1) {
 			++nonzero;
@@ -99,8 +154,7 @@ struct ModeState {
 		}
 	}
 
-	void ModeRm(const KEY_TYPE &key, idx_t frame) {
-		auto &attr = (*frequency_map)[key];
+	void ModeRm(ModeAttr &attr, const KEY_TYPE &key) {
 		auto old_count = attr.count;
 		nonzero -= size_t(old_count == 1);
 
@@ -123,6 +177,36 @@ struct ModeState {
 		}
 		return highest_frequency;
 	}
+
+	//! Finds the most frequent value since the last reset
+	void Rescan() {
+		if (dense) {
+			optional_ptr<const ModeAttr> highest_frequency;
+			uint32_t highest_id = 0;
+			for (const auto id : dense_touched) {
+				// Tie break with the lowest insert position
+				const auto &attr = dense_counts[id];
+				if (!highest_frequency || attr.count > highest_frequency->count ||
+				    (attr.count == highest_frequency->count && attr.first_row < highest_frequency->first_row)) {
+					highest_frequency = &attr;
+					highest_id = id;
+				}
+			}
+			if (highest_frequency) {
+				*mode = dense->keys[highest_id];
+				count = highest_frequency->count;
+				valid = (count > 0);
+			}
+			return;
+		}
+
+		auto highest_frequency = Scan();
+		if (highest_frequency != frequency_map->end()) {
+			*mode = highest_frequency->first;
+			count = highest_frequency->second.count;
+			valid = (count > 0);
+		}
+	}
 };
 
 struct ModeIncluded {
@@ -229,7 +313,7 @@ struct ModeFunction {
 		inline void Left(idx_t begin, idx_t end) {
 			for (; begin < end; ++begin) {
 				if (included(begin)) {
-					state.ModeRm(KEY_TYPE(data[begin]), begin);
+					state.ModeRm(data, begin);
 				}
 			}
 		}
@@ -237,7 +321,7 @@ struct ModeFunction {
 		inline void Right(idx_t begin, idx_t end) {
 			for (; begin < end; ++begin) {
 				if (included(begin)) {
-					state.ModeAdd(KEY_TYPE(data[begin]), begin);
+					state.ModeAdd(data, begin);
 				}
 			}
 		}
@@ -246,6 +330,44 @@ struct ModeFunction {
 		}
 	};
 
+	//! The maximum number of distinct values that are numbered, as every thread keeps a count for each of them
+	static constexpr idx_t MAX_DENSE_KEYS = 1 << 20;
+
+	template <class STATE, class INPUT_TYPE>
+	static void WindowInit(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+	                       data_ptr_t g_state) {
+		D_ASSERT(partition.input_count == 1);
+
+		const auto count = partition.count;
+		const auto data = FlatVector::GetData<const INPUT_TYPE>(partition.inputs[0]);
+		const auto &dmask = FlatVector::Validity(partition.inputs[0]);
+		ModeIncluded included(partition.filter_mask, dmask);
+
+		//	Number the values once, so the frames can be counted without hashing the values again.
+		//	Wide frames hash every value of a frame whenever a thread starts on a new block of rows.
+		auto dense_keys = make_uniq<typename STATE::DenseKeys>();
+		dense_keys->ids.resize(count);
+		unordered_map<KEY_TYPE, uint32_t> numbers;
+		for (idx_t i = 0; i < count; ++i) {
+			if (!included(i)) {
+				continue;
+			}
+			const auto key = KEY_TYPE(data[i]);
+			auto entry = numbers.find(key);
+			if (entry == numbers.end()) {
+				if (dense_keys->keys.size() >= MAX_DENSE_KEYS) {
+					return;
+				}
+				entry = numbers.emplace(key, UnsafeNumericCast<uint32_t>(dense_keys->keys.size())).first;
+				dense_keys->keys.emplace_back(key);
+			}
+			dense_keys->ids[i] = entry->second;
+		}
+
+		auto &gstate = *reinterpret_cast<STATE *>(g_state);
+		gstate.dense_keys = std::move(dense_keys);
+	}
+
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
 	                   AggregateInputData &aggr_input_data, STATE &state, const SubFrames &frames, Vector &result,
@@ -262,15 +384,19 @@ struct ModeFunction {
 		if (!state.frequency_map) {
 			state.frequency_map = new typename STATE::Counts;
 		}
+		if (gstate && gstate->dense_keys && !state.dense) {
+			state.dense = gstate->dense_keys.get();
+			state.dense_counts.resize(state.dense->keys.size());
+		}
 		const double tau = .25;
-		if (state.nonzero <= tau * state.frequency_map->size() || prevs.back().end <= frames.front().start ||
+		if (state.nonzero <= tau * state.Size() || prevs.back().end <= frames.front().start ||
 		    frames.back().end <= prevs.front().start) {
 			state.Reset();
 			// for f ∈ F do
 			for (const auto &frame : frames) {
 				for (auto i = frame.start; i < frame.end; ++i) {
 					if (included(i)) {
-						state.ModeAdd(KEY_TYPE(data[i]), i);
+						state.ModeAdd(data, i);
 					}
 				}
 			}
@@ -281,13 +407,7 @@ struct ModeFunction {
 		}
 
 		if (!state.valid) {
-			// Rescan
-			auto highest_frequency = state.Scan();
-			if (highest_frequency != state.frequency_map->end()) {
-				*(state.mode) = highest_frequency->first;
-				state.count = highest_frequency->second.count;
-				state.valid = (state.count > 0);
-			}
+			state.Rescan();
 		}
 
 		if (state.valid) {
@@ -316,6 +436,7 @@ AggregateFunction GetTypedModeFunction(const LogicalType &type) {
 	auto return_type = type.id() == LogicalTypeId::ANY ? LogicalType::VARCHAR : type;
 	auto func = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	func.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	func.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
 	return func;
 }
 
@@ -568,7 +568,9 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 	using BaseTree = MergeSortTree<IDX, IDX>;
 	using Elements = typename BaseTree::Elements;
 
-	explicit QuantileSortTree(Elements &&lowest_level) : BaseTree(std::move(lowest_level)) {
+	//! Allocates the levels of the tree, which are then built in parallel by WindowBuild
+	explicit QuantileSortTree(Elements &&lowest_level) {
+		BaseTree::Allocate(std::move(lowest_level));
 	}
 
 	template <class INPUT_TYPE>
@@ -811,6 +813,9 @@ struct QuantileState {
 };
 
 struct QuantileOperation {
+	//! Frames that always share at least this many rows use the sort tree instead of skip lists
+	static constexpr idx_t WIDE_FRAME_SIZE = 16 * STANDARD_VECTOR_SIZE;
+
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		new (&state) STATE();
@@ -857,12 +862,15 @@ struct QuantileOperation {
 		const auto &stats = partition.stats;
 
 		//	If frames overlap significantly, then use local skip lists.
+		//	Wide frames are the exception: every thread has to insert a whole frame into its skip list
+		//	whenever it starts on a new block of rows, which costs more than probing the tree.
 		if (stats[0].end <= stats[1].begin) {
 			//	Frames can overlap
 			const auto overlap = double(stats[1].begin - stats[0].end);
 			const auto cover = double(stats[1].end - stats[0].begin);
 			const auto ratio = overlap / cover;
-			if (ratio > .75) {
+			const auto wide = double(WIDE_FRAME_SIZE);
+			if (ratio > .75 && overlap < wide) {
 				return;
 			}
 		}
@@ -881,6 +889,18 @@ struct QuantileOperation {
 		}
 	}
 
+	template <class STATE>
+	static void WindowBuild(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+	                        data_ptr_t g_state) {
+		//	Build the levels of the tree together with any other waiting threads
+		auto &state = *reinterpret_cast<STATE *>(g_state);
+		if (state.qst32) {
+			state.qst32->Build();
+		} else if (state.qst64) {
+			state.qst64->Build();
+		}
+	}
+
 	static idx_t FrameSize(const QuantileIncluded &included, const SubFrames &frames) {
 		//	Count the number of valid values
 		idx_t n = 0;
@@ -970,6 +990,7 @@ AggregateFunction GetTypedDiscreteQuantileAggregateFunction(const LogicalType &t
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
 	fun.window_init = OP::WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::WindowBuild<STATE>;
 	return fun;
 }
 
@@ -1092,6 +1113,7 @@ AggregateFunction GetTypedDiscreteQuantileListAggregateFunction(const LogicalTyp
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::template WindowBuild<STATE>;
 	return fun;
 }
 
@@ -1150,6 +1172,7 @@ AggregateFunction GetTypedContinuousQuantileAggregateFunction(const LogicalType
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::template WindowBuild<STATE>;
 	return fun;
 }
 
@@ -1205,6 +1228,7 @@ AggregateFunction GetTypedContinuousQuantileListAggregateFunction(const LogicalT
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::template WindowBuild<STATE>;
 	return fun;
 }
 
@@ -1420,6 +1444,7 @@ AggregateFunction GetTypedMedianAbsoluteDeviationAggregateFunction(const Logical
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::template WindowBuild<STATE>;
 	return fun;
 }
 
@@ -1,4 +1,5 @@
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -10,6 +11,89 @@ ExecuteFunctionState::ExecuteFunctionState(const Expression &expr, ExpressionExe
 ExecuteFunctionState::~ExecuteFunctionState() {
 }
 
+//! Whether every entry of the dictionary is referenced by a row. Only then does executing a function on the dictionary
+//! evaluate exactly the values that executing it on the rows would (e.g., no values of rows that were filtered out)
+static bool AllDictionaryEntriesReferenced(const SelectionVector &sel, idx_t count, idx_t dictionary_size) {
+	if (dictionary_size > count) {
+		return false;
+	}
+	auto referenced = make_unsafe_uniq_array<bool>(dictionary_size);
+	memset(referenced.get(), 0, dictionary_size * sizeof(bool));
+	idx_t referenced_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto entry = sel.get_index(i);
+		if (!referenced[entry]) {
+			referenced[entry] = true;
+			referenced_count++;
+		}
+	}
+	return referenced_count == dictionary_size;
+}
+
+bool ExecuteFunctionState::TryExecuteDictionaryExpression(const BoundFunctionExpression &expr, DataChunk &args,
+                                                          Vector &result) {
+	if (expr.IsVolatile()) {
+		return false;
+	}
+	// the function must have a single non-constant input, which must be a dictionary vector with a known dictionary
+	optional_idx input_col_idx;
+	for (idx_t col_idx = 0; col_idx < args.ColumnCount(); col_idx++) {
+		if (expr.children[col_idx]->IsFoldable()) {
+			continue;
+		}
+		if (input_col_idx.IsValid()) {
+			return false;
+		}
+		input_col_idx = col_idx;
+	}
+	if (!input_col_idx.IsValid()) {
+		return false;
+	}
+	auto &input = args.data[input_col_idx.GetIndex()];
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	auto dictionary_id = DictionaryVector::DictionaryId(input);
+	if (!dictionary_size.IsValid() || !dictionary_id.IsValid()) {
+		return false;
+	}
+	auto &sel = DictionaryVector::SelVector(input);
+
+	if (!input_dictionary_id.IsValid() || input_dictionary_id.GetIndex() != dictionary_id.GetIndex()) {
+		// the function can only be executed on the dictionary if it evaluates no other values than the rows do, so
+		// that it cannot fail on values that the rows do not reference
+		if (!AllDictionaryEntriesReferenced(sel, args.size(), dictionary_size.GetIndex())) {
+			return false;
+		}
+
+		// execute the function once for every entry of the dictionary
+		DataChunk dictionary_args;
+		dictionary_args.InitializeEmpty(args.GetTypes());
+		for (idx_t col_idx = 0; col_idx < args.ColumnCount(); col_idx++) {
+			if (col_idx == input_col_idx.GetIndex()) {
+				dictionary_args.data[col_idx].Reference(DictionaryVector::Child(input));
+			} else {
+				dictionary_args.data[col_idx].Reference(args.data[col_idx]);
+			}
+		}
+		dictionary_args.SetCardinality(dictionary_size.GetIndex());
+
+		auto new_dictionary = make_uniq<Vector>(result.GetType(), dictionary_size.GetIndex());
+		expr.function.function(dictionary_args, *this, *new_dictionary);
+		new_dictionary->Flatten(dictionary_size.GetIndex());
+		output_dictionary = std::move(new_dictionary);
+		input_dictionary_id = dictionary_id;
+		output_dictionary_id = DictionaryVector::GenerateDictionaryId();
+	}
+
+	result.Dictionary(*output_dictionary, dictionary_size.GetIndex(), sel, args.size());
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		DictionaryVector::SetDictionaryId(result, output_dictionary_id);
+	}
+	return true;
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
@@ -75,7 +159,10 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
-	expr.function.function(arguments, *state, result);
+	auto &function_state = state->Cast<ExecuteFunctionState>();
+	if (!function_state.TryExecuteDictionaryExpression(expr, arguments, result)) {
+		expr.function.function(arguments, *state, result);
+	}
 
 	VerifyNullHandling(expr, arguments, result);
 	D_ASSERT(result.GetType() == expr.return_type);
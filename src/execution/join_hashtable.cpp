@@ -18,7 +18,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), partition_mask(0), partition_shift(0), partition_offset(0),
+      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -86,32 +87,39 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
-}
-
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	auto entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
+	auto entry_offsets = partition_entry_offsets.data();
 	for (idx_t i = 0; i < count; i++) {
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		auto salt = ht_entry_t::ExtractSalt(hash);
+
+		// find the region of the partition that this hash belongs to
+		const auto partition_idx = ((hash & partition_mask) >> partition_shift) - partition_offset;
+		D_ASSERT(partition_idx < partition_counts.size());
+		const auto region = entries + entry_offsets[partition_idx];
+		const auto region_bitmask = entry_offsets[partition_idx + 1] - entry_offsets[partition_idx] - 1;
+
+		// linear probing: the salt rejects (almost) all entries of other keys without touching their rows
+		data_ptr_t row_pointer = nullptr;
+		for (idx_t ht_offset = hash & region_bitmask;; ht_offset = (ht_offset + 1) & region_bitmask) {
+			const auto &entry = region[ht_offset];
+			if (!entry.IsOccupied()) {
+				break;
+			}
+			if (entry.GetSalt() == salt) {
+				row_pointer = entry.GetPointer();
+				break;
+			}
+		}
+		result_data[rindex] = row_pointer;
 	}
 }
 
@@ -244,66 +252,115 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
+static inline void InsertHashesLoop(atomic<ht_entry_t> entries[], const idx_t entry_offsets[],
+                                    const hash_t partition_mask, const idx_t partition_shift,
+                                    const idx_t partition_offset, const hash_t hashes[], const idx_t count,
                                     const data_ptr_t key_locations[], const idx_t pointer_offset) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
-		if (PARALLEL) {
-			data_ptr_t head;
-			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
-		} else {
-			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
-
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+		const auto salt = ht_entry_t::ExtractSalt(hashes[i]);
+		const auto row_location = key_locations[i];
+		const auto desired = ht_entry_t::GetDesiredEntry(row_location, salt);
+
+		const auto partition_idx = ((hashes[i] & partition_mask) >> partition_shift) - partition_offset;
+		const auto region = entries + entry_offsets[partition_idx];
+		const auto region_bitmask = entry_offsets[partition_idx + 1] - entry_offsets[partition_idx] - 1;
+
+		// find the first entry that is either empty or has the same salt, and prepend the row to its chain
+		idx_t ht_offset = hashes[i] & region_bitmask;
+		while (true) {
+			auto &atomic_entry = region[ht_offset];
+			auto entry = atomic_entry.load(std::memory_order_relaxed);
+			if (entry.IsOccupied() && entry.GetSalt() != salt) {
+				ht_offset = (ht_offset + 1) & region_bitmask;
+				continue;
+			}
+			// set next in the current row to the previous head of the chain (NOTE: this is nullptr if there is none)
+			Store<data_ptr_t>(entry.IsOccupied() ? entry.GetPointer() : nullptr, row_location + pointer_offset);
+			if (PARALLEL) {
+				if (!atomic_entry.compare_exchange_weak(entry, desired, std::memory_order_release,
+				                                        std::memory_order_relaxed)) {
+					// another thread modified this entry - try again
+					continue;
+				}
+			} else {
+				atomic_entry.store(desired, std::memory_order_relaxed);
+			}
+			break;
 		}
 	}
 }
 
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
-
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto entries = reinterpret_cast<atomic<ht_entry_t> *>(hash_map.get());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
+	auto entry_offsets = partition_entry_offsets.data();
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(entries, entry_offsets, partition_mask, partition_shift, partition_offset, hash_data,
+		                       count, key_locations, pointer_offset);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(entries, entry_offsets, partition_mask, partition_shift, partition_offset, hash_data,
+		                        count, key_locations, pointer_offset);
 	}
 }
 
-void JoinHashTable::InitializePointerTable() {
-	idx_t capacity = PointerTableCapacity(Count());
-	D_ASSERT(IsPowerOfTwo(capacity));
+void JoinHashTable::SetPointerTablePartitions(idx_t partition_idx_from, idx_t partition_idx_to) {
+	auto &partitions = sink_collection->GetPartitions();
+	partition_mask = RadixPartitioning::Mask(radix_bits);
+	partition_shift = RadixPartitioning::Shift(radix_bits);
+	partition_offset = partition_idx_from;
+
+	partition_counts.clear();
+	partition_chunk_offsets.clear();
+	partition_chunk_offsets.push_back(0);
+	for (idx_t partition_idx = partition_idx_from; partition_idx < partition_idx_to; partition_idx++) {
+		auto &partition = *partitions[partition_idx];
+		// empty partitions are skipped when they are combined into data_collection
+		const auto chunk_count = partition.Count() == 0 ? 0 : partition.ChunkCount();
+		partition_counts.push_back(partition.Count());
+		partition_chunk_offsets.push_back(partition_chunk_offsets.back() + chunk_count);
+	}
+}
+
+void JoinHashTable::AllocatePointerTable() {
+	D_ASSERT(partition_counts.size() == PointerTablePartitionCount());
+	partition_entry_offsets.clear();
+	partition_entry_offsets.push_back(0);
+	for (auto &partition_count : partition_counts) {
+		const auto partition_capacity = PartitionPointerTableCapacity(partition_count);
+		D_ASSERT(IsPowerOfTwo(partition_capacity));
+		partition_entry_offsets.push_back(partition_entry_offsets.back() + partition_capacity);
+	}
+	const auto capacity = partition_entry_offsets.back();
 
 	if (hash_map.get()) {
 		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
+		auto current_capacity = hash_map.GetSize() / sizeof(ht_entry_t);
 		if (capacity != current_capacity) {
 			// Different size, re-allocate
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 		}
 	} else {
 		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
+}
 
-	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+void JoinHashTable::InitializePointerTable(idx_t entry_idx_from, idx_t entry_idx_to) {
+	D_ASSERT(entry_idx_from <= entry_idx_to && entry_idx_to <= partition_entry_offsets.back());
+	// initialize the entries with all-empty entries
+	std::fill_n(reinterpret_cast<ht_entry_t *>(hash_map.get()) + entry_idx_from, entry_idx_to - entry_idx_from,
+	            ht_entry_t::GetEmptyEntry());
+}
 
-	bitmask = capacity - 1;
+void JoinHashTable::InitializePointerTable() {
+	AllocatePointerTable();
+	InitializePointerTable(0, partition_entry_offsets.back());
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -353,14 +410,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -468,7 +525,6 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
 			sel_vector.set_index(non_empty_count++, idx);
 		}
@@ -881,10 +937,11 @@ idx_t JoinHashTable::GetTotalSize(const vector<idx_t> &partition_sizes, const ve
 	max_partition_size = 0;
 	max_partition_count = 0;
 	for (idx_t i = 0; i < num_partitions; i++) {
-		total_size += partition_sizes[i];
+		// every partition gets its own power-of-two region in the pointer table
+		total_size += partition_sizes[i] + PartitionPointerTableSize(partition_counts[i]);
 		total_count += partition_counts[i];
 
-		auto partition_size = partition_sizes[i] + PointerTableSize(partition_counts[i]);
+		auto partition_size = partition_sizes[i] + PartitionPointerTableSize(partition_counts[i]);
 		if (partition_size > max_partition_ht_size) {
 			max_partition_ht_size = partition_size;
 			max_partition_size = partition_sizes[i];
@@ -896,7 +953,7 @@ idx_t JoinHashTable::GetTotalSize(const vector<idx_t> &partition_sizes, const ve
 		return 0;
 	}
 
-	return total_size + PointerTableSize(total_count);
+	return total_size;
 }
 
 idx_t JoinHashTable::GetTotalSize(vector<unique_ptr<JoinHashTable>> &local_hts, idx_t &max_partition_size,
@@ -915,23 +972,23 @@ idx_t JoinHashTable::GetRemainingSize() {
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	auto &partitions = sink_collection->GetPartitions();
 
-	idx_t count = 0;
-	idx_t data_size = 0;
+	idx_t ht_size = 0;
 	for (idx_t partition_idx = partition_end; partition_idx < num_partitions; partition_idx++) {
-		count += partitions[partition_idx]->Count();
-		data_size += partitions[partition_idx]->SizeInBytes();
+		ht_size += partitions[partition_idx]->SizeInBytes() +
+		           PartitionPointerTableSize(partitions[partition_idx]->Count());
 	}
 
-	return data_size + PointerTableSize(count);
+	return ht_size;
 }
 
 void JoinHashTable::Unpartition() {
+	SetPointerTablePartitions(0, sink_collection->GetPartitions().size());
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
 void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
                                             const idx_t max_partition_size, const idx_t max_partition_count) {
-	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
+	D_ASSERT(max_partition_size + PartitionPointerTableSize(max_partition_count) > max_ht_size);
 
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
 	idx_t added_bits = 1;
@@ -940,8 +997,8 @@ void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &l
 
 		auto new_estimated_size = double(max_partition_size) / partition_multiplier;
 		auto new_estimated_count = double(max_partition_count) / partition_multiplier;
-		auto new_estimated_ht_size =
-		    new_estimated_size + static_cast<double>(PointerTableSize(NumericCast<idx_t>(new_estimated_count)));
+		auto new_estimated_pointer_table_size = PartitionPointerTableSize(NumericCast<idx_t>(new_estimated_count));
+		auto new_estimated_ht_size = new_estimated_size + static_cast<double>(new_estimated_pointer_table_size);
 
 		if (new_estimated_ht_size <= double(max_ht_size) / 4) {
 			// Aim for an estimated partition size of max_ht_size / 4
@@ -982,21 +1039,22 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 
 	// Determine how many partitions we can do next (at least one)
 	idx_t count = 0;
-	idx_t data_size = 0;
+	idx_t ht_size = 0;
 	idx_t partition_idx;
 	for (partition_idx = partition_start; partition_idx < num_partitions; partition_idx++) {
-		auto incl_count = count + partitions[partition_idx]->Count();
-		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
-		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
+		auto &partition = *partitions[partition_idx];
+		auto incl_count = count + partition.Count();
+		auto incl_ht_size = ht_size + partition.SizeInBytes() + PartitionPointerTableSize(partition.Count());
 		if (count > 0 && incl_ht_size > max_ht_size) {
 			break;
 		}
 		count = incl_count;
-		data_size = incl_data_size;
+		ht_size = incl_ht_size;
 	}
 	partition_end = partition_idx;
 
 	// Move the partitions to the main data collection
+	SetPointerTablePartitions(partition_start, partition_end);
 	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
 		data_collection->Combine(*partitions[partition_idx]);
 	}
@@ -1055,7 +1113,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
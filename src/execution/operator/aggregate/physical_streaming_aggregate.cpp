@@ -0,0 +1,328 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
+
+	vector<BoundAggregateExpression *> bindings;
+	vector<LogicalType> payload_types_filters;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		D_ASSERT(expr->IsAggregate());
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+
+		D_ASSERT(!aggr.IsDistinct());
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+		if (aggr.filter) {
+			payload_types_filters.push_back(aggr.filter->return_type);
+		}
+	}
+	for (const auto &pay_filters : payload_types_filters) {
+		payload_types.push_back(pay_filters);
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+
+	// filter_indexes must be pre-built, not lazily instantiated in parallel...
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		aggregate_input_idx += aggr.children.size();
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto &bound_ref_expr = aggr.filter->Cast<BoundReferenceExpression>();
+			auto it = filter_indexes.find(aggr.filter.get());
+			if (it == filter_indexes.end()) {
+				filter_indexes[aggr.filter.get()] = bound_ref_expr.index;
+				bound_ref_expr.index = aggregate_input_idx++;
+			} else {
+				++aggregate_input_idx;
+			}
+		}
+	}
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+	    : current_buffer(1), current_state(nullptr), current_keys(op.groups.size()), addresses(LogicalType::POINTER),
+	      started(LogicalType::POINTER), finished(LogicalType::POINTER) {
+		layout.Initialize(op.aggregate_objects);
+		for (idx_t buffer_idx = 0; buffer_idx < states.size(); ++buffer_idx) {
+			states[buffer_idx] = make_unsafe_uniq_array<data_t>(STANDARD_VECTOR_SIZE * layout.GetRowWidth());
+			allocators[buffer_idx] = make_uniq<ArenaAllocator>(Allocator::Get(context.client));
+		}
+
+		group_chunk.InitializeEmpty(op.group_types);
+		if (!op.payload_types.empty()) {
+			payload_chunk.InitializeEmpty(op.payload_types);
+		}
+		filter_set.Initialize(context.client, op.aggregate_objects, op.payload_types);
+
+		next_sel.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; ++i) {
+			next_sel.set_index(i, i + 1);
+		}
+		distinct_sel.Initialize(STANDARD_VECTOR_SIZE);
+		same_sel.Initialize(STANDARD_VECTOR_SIZE);
+		remaining_sel.Initialize(STANDARD_VECTOR_SIZE);
+		starts.Initialize(STANDARD_VECTOR_SIZE);
+	}
+
+	~StreamingAggregateState() override {
+		if (current_state) {
+			FlatVector::GetData<data_ptr_t>(finished)[0] = current_state;
+			RowOperationsState row_state(*allocators[current_buffer]);
+			RowOperations::DestroyStates(row_state, layout, finished, 1);
+		}
+	}
+
+	//! The layout of the aggregate states of a group
+	TupleDataLayout layout;
+	//! The aggregate states of the groups that start in a chunk, and their allocators.
+	//! New groups use the buffer that does not hold the current group, so it can be reset.
+	array<unsafe_unique_array<data_t>, 2> states;
+	array<unique_ptr<ArenaAllocator>, 2> allocators;
+	//! The buffer that holds the current group
+	idx_t current_buffer;
+	//! The aggregate states of the current group, which can continue in the next chunk
+	data_ptr_t current_state;
+	//! The keys of the current group
+	vector<Value> current_keys;
+
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+	//! Intermediate structures and data for aggregate filters
+	AggregateFilterDataSet filter_set;
+
+	//! Whether each input row starts a new group
+	bool new_group[STANDARD_VECTOR_SIZE];
+	//! Selects the row after each input row
+	SelectionVector next_sel;
+	//! Scratch selections for comparing the keys of adjacent rows
+	SelectionVector distinct_sel;
+	SelectionVector same_sel;
+	SelectionVector remaining_sel;
+	//! The first row of each group that starts in the chunk
+	SelectionVector starts;
+	//! The aggregate states of each input row
+	Vector addresses;
+	//! The groups that start in the chunk
+	Vector started;
+	//! The groups that end in the chunk
+	Vector finished;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (!count) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	auto &group_chunk = state.group_chunk;
+	auto &payload_chunk = state.payload_chunk;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = groups[group_idx];
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[group_idx].Reference(input.data[bound_ref_expr.index]);
+	}
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child_expr : aggr.children) {
+			D_ASSERT(child_expr->type == ExpressionType::BOUND_REF);
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			payload_chunk.data[aggregate_input_idx++].Reference(input.data[bound_ref_expr.index]);
+		}
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto it = filter_indexes.find(aggr.filter.get());
+			D_ASSERT(it != filter_indexes.end());
+			payload_chunk.data[aggregate_input_idx++].Reference(input.data[it->second]);
+		}
+	}
+	group_chunk.SetCardinality(count);
+	payload_chunk.SetCardinality(count);
+
+	//	Find the rows that start a new group.
+	//	The first row is compared with the current group, every other row with the row before it.
+	auto new_group = state.new_group;
+	new_group[0] = !state.current_state;
+	for (idx_t col_idx = 0; col_idx < groups.size() && !new_group[0]; ++col_idx) {
+		new_group[0] = !Value::NotDistinctFrom(state.current_keys[col_idx], group_chunk.GetValue(col_idx, 0));
+	}
+	memset(new_group + 1, 0, (count - 1) * sizeof(bool));
+
+	//	The comparisons read their inputs densely and only map the results through the selection,
+	//	so the keys of the rows that still compare equal are sliced out first.
+	optional_ptr<const SelectionVector> remaining;
+	idx_t remaining_count = count - 1;
+	for (idx_t col_idx = 0; col_idx < groups.size() && remaining_count; ++col_idx) {
+		auto &keys = group_chunk.data[col_idx];
+		Vector next_keys(keys, state.next_sel, count - 1);
+		Vector prev_keys(keys);
+		if (remaining) {
+			next_keys.Slice(*remaining, remaining_count);
+			prev_keys.Slice(*remaining, remaining_count);
+		}
+		const auto distinct_count = VectorOperations::DistinctFrom(next_keys, prev_keys, remaining, remaining_count,
+		                                                           &state.distinct_sel, &state.same_sel);
+		for (idx_t i = 0; i < distinct_count; ++i) {
+			new_group[state.distinct_sel.get_index(i) + 1] = true;
+		}
+		remaining_count -= distinct_count;
+		std::swap(state.remaining_sel, state.same_sel);
+		remaining = &state.remaining_sel;
+	}
+
+	//	Point every row to the states of its group
+	const auto buffer_idx = state.current_buffer ? 0 : 1;
+	const auto row_width = state.layout.GetRowWidth();
+	const auto aggr_offset = state.layout.GetAggrOffset();
+	auto started = FlatVector::GetData<data_ptr_t>(state.started);
+	auto finished = FlatVector::GetData<data_ptr_t>(state.finished);
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	//	The current group is the first one to end
+	const auto finish_current = state.current_state != nullptr;
+	idx_t started_count = 0;
+	idx_t finished_count = 0;
+	auto row_state = state.current_state;
+	for (idx_t i = 0; i < count; ++i) {
+		if (new_group[i]) {
+			if (row_state) {
+				finished[finished_count++] = row_state;
+			}
+			row_state = state.states[buffer_idx].get() + started_count * row_width;
+			state.starts.set_index(started_count, i);
+			started[started_count++] = row_state;
+		}
+		addresses[i] = row_state + aggr_offset;
+	}
+	if (started_count) {
+		//	All the groups in this buffer have been emitted
+		state.allocators[buffer_idx]->Reset();
+		RowOperations::InitializeStates(state.layout, state.started, *FlatVector::IncrementalSelectionVector(),
+		                                started_count);
+	}
+
+	//	Update the aggregates
+	auto &allocator = *state.allocators[started_count ? buffer_idx : state.current_buffer];
+	RowOperationsState row_operations_state(allocator);
+	auto &aggregate_objects = state.layout.GetAggregates();
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_objects.size(); aggr_idx++) {
+		auto &aggregate = aggregate_objects[aggr_idx];
+		if (aggregate.filter) {
+			RowOperations::UpdateFilteredStates(row_operations_state, state.filter_set.GetFilterData(aggr_idx),
+			                                    aggregate, state.addresses, payload_chunk, payload_idx);
+		} else {
+			RowOperations::UpdateStates(row_operations_state, aggregate, state.addresses, payload_chunk, payload_idx,
+			                            count);
+		}
+		// move to the next aggregate
+		payload_idx += aggregate.child_count;
+		VectorOperations::AddInPlace(state.addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+
+	//	Emit the groups that ended in this chunk
+	if (finished_count) {
+		idx_t out_idx = 0;
+		if (finish_current) {
+			for (idx_t col_idx = 0; col_idx < groups.size(); ++col_idx) {
+				chunk.SetValue(col_idx, out_idx, state.current_keys[col_idx]);
+			}
+			++out_idx;
+		}
+		for (idx_t col_idx = 0; col_idx < groups.size(); ++col_idx) {
+			VectorOperations::Copy(group_chunk.data[col_idx], chunk.data[col_idx], state.starts,
+			                       finished_count - out_idx, 0, out_idx);
+		}
+		chunk.SetCardinality(finished_count);
+		RowOperations::FinalizeStates(row_operations_state, state.layout, state.finished, chunk, groups.size());
+		RowOperations::DestroyStates(row_operations_state, state.layout, state.finished, finished_count);
+	}
+
+	//	The last group can continue in the next chunk
+	if (started_count) {
+		state.current_state = started[started_count - 1];
+		state.current_buffer = buffer_idx;
+		const auto first_row = state.starts.get_index(started_count - 1);
+		for (idx_t col_idx = 0; col_idx < groups.size(); ++col_idx) {
+			state.current_keys[col_idx] = group_chunk.GetValue(col_idx, first_row);
+		}
+	}
+
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.current_state) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+
+	//	Emit the last group
+	for (idx_t col_idx = 0; col_idx < groups.size(); ++col_idx) {
+		chunk.SetValue(col_idx, 0, state.current_keys[col_idx]);
+	}
+	chunk.SetCardinality(1);
+	FlatVector::GetData<data_ptr_t>(state.finished)[0] = state.current_state;
+	RowOperationsState row_state(*state.allocators[state.current_buffer]);
+	RowOperations::FinalizeStates(row_state, state.layout, state.finished, chunk, groups.size());
+	RowOperations::DestroyStates(row_state, state.layout, state.finished, 1);
+	state.current_state = nullptr;
+
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
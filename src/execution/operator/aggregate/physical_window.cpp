@@ -192,6 +192,8 @@ public:
 
 	//! Get the next task
 	Task NextTask(idx_t hash_bin);
+	//! Help to finalize a partition that is being built
+	void AssistFinalize();
 
 	//! Context for executing computations
 	ClientContext &context;
@@ -203,6 +205,8 @@ public:
 	vector<HashGroupSourcePtr> built;
 	//! Serialise access to the built hash groups
 	mutable mutex built_lock;
+	//! The partitions whose executors are being finalized
+	vector<WindowPartitionSourceState *> finalizing;
 	//! The number of unfinished tasks
 	atomic<idx_t> tasks_remaining;
 	//! The number of rows returned
@@ -261,13 +265,14 @@ public:
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0), helpers(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	void FinalizeExecutors();
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -294,6 +299,8 @@ public:
 	mutable atomic<idx_t> read_block_idx;
 	//! The number of remaining unscanned blocks.
 	atomic<idx_t> unscanned;
+	//! The number of threads helping to finalize the executors
+	atomic<idx_t> helpers;
 };
 
 void WindowPartitionSourceState::MaterializeSortedData() {
@@ -418,35 +425,64 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		executors.emplace_back(std::move(wexec));
 	}
 
-	//	First pass over the input without flushing
-	DataChunk input_chunk;
-	input_chunk.Initialize(gpart.allocator, gpart.payload_types);
-	auto scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
-	idx_t input_idx = 0;
-	while (true) {
-		input_chunk.Reset();
-		scanner->Scan(input_chunk);
-		if (input_chunk.size() == 0) {
-			break;
-		}
+	//	First pass over the input without flushing,
+	//	which functions like ROW_NUMBER that only use the masks can skip.
+	bool requires_sink = false;
+	for (auto &wexec : executors) {
+		requires_sink = requires_sink || wexec->RequiresSink();
+	}
+	if (requires_sink) {
+		DataChunk input_chunk;
+		input_chunk.Initialize(gpart.allocator, gpart.payload_types);
+		auto scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+		idx_t input_idx = 0;
+		while (true) {
+			input_chunk.Reset();
+			scanner->Scan(input_chunk);
+			if (input_chunk.size() == 0) {
+				break;
+			}
 
-		//	TODO: Parallelization opportunity
-		for (auto &wexec : executors) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+			//	TODO: Parallelization opportunity
+			for (auto &wexec : executors) {
+				wexec->Sink(input_chunk, input_idx, scanner->Count());
+			}
+			input_idx += input_chunk.size();
 		}
-		input_idx += input_chunk.size();
+
+		FinalizeExecutors();
+
+		// External scanning assumes all blocks are swizzled.
+		scanner->ReSwizzle();
+	} else {
+		FinalizeExecutors();
+	}
+
+	//	Start the block countdown
+	unscanned = rows->blocks.size();
+}
+
+void WindowPartitionSourceState::FinalizeExecutors() {
+	//	Let the threads that are waiting for work help to build the shared structures
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		gsource.finalizing.emplace_back(this);
 	}
 
-	//	TODO: Parallelization opportunity
 	for (auto &wexec : executors) {
 		wexec->Finalize();
 	}
 
-	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		auto &finalizing = gsource.finalizing;
+		finalizing.erase(std::find(finalizing.begin(), finalizing.end(), this));
+	}
 
-	//	Start the block countdown
-	unscanned = rows->blocks.size();
+	//	The helpers reference our executors, so wait for them to leave
+	while (helpers) {
+		TaskScheduler::YieldThread();
+	}
 }
 
 // Per-thread scan state
@@ -580,13 +616,31 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		}
 
 		//	If there is nothing to steal but there are unfinished partitions,
-		//	yield until any pending builds are done.
+		//	help with any pending builds and yield until they are done.
+		AssistFinalize();
 		TaskScheduler::YieldThread();
 	}
 
 	return Task();
 }
 
+void WindowGlobalSourceState::AssistFinalize() {
+	optional_ptr<WindowPartitionSourceState> partition_source;
+	{
+		lock_guard<mutex> built_guard(built_lock);
+		if (finalizing.empty()) {
+			return;
+		}
+		partition_source = finalizing.back();
+		++partition_source->helpers;
+	}
+
+	for (auto &wexec : partition_source->executors) {
+		wexec->AssistFinalize();
+	}
+	--partition_source->helpers;
+}
+
 void WindowLocalSourceState::UpdateBatchIndex() {
 	D_ASSERT(partition_source);
 	D_ASSERT(scanner.get());
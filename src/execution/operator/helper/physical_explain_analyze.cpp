@@ -21,6 +21,8 @@ SinkFinalizeType PhysicalExplainAnalyze::Finalize(Pipeline &pipeline, Event &eve
                                                   OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<ExplainAnalyzeStateGlobalState>();
 	auto &profiler = QueryProfiler::Get(context);
+	// the analyzed operators are done: show the parameters they ended up with
+	profiler.UpdateExtraInfo();
 	gstate.analyzed_plan = profiler.ToString();
 	return SinkFinalizeType::READY;
 }
@@ -3,7 +3,12 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -97,9 +102,46 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	return SinkFinalizeType::READY;
 }
 
+//! Request that the next checkpoint compacts the table, returns false if the table cannot be compacted
+static bool RequestVacuum(TableCatalogEntry &table) {
+	if (!table.IsDuckTable()) {
+		return true;
+	}
+	return table.GetStorage().RequestVacuum();
+}
+
 SourceResultType PhysicalVacuum::GetData(ExecutionContext &context, DataChunk &chunk,
                                          OperatorSourceInput &input) const {
-	// NOP
+	if (!info->options.vacuum) {
+		// ANALYZE only gathers statistics
+		return SourceResultType::FINISHED;
+	}
+	// VACUUM: rewrite the row groups that contain deleted rows and merge small row groups by checkpointing
+	auto &client = context.client;
+	auto &db = table ? table->catalog.GetAttached()
+	                 : *DatabaseManager::Get(client).GetDatabase(client, DatabaseManager::GetDefaultDatabase(client));
+	auto &catalog = db.GetCatalog();
+	if (!catalog.IsDuckCatalog() || catalog.InMemory()) {
+		return SourceResultType::FINISHED;
+	}
+	if (table) {
+		auto tbl = table;
+		if (!RequestVacuum(*tbl)) {
+			throw NotImplementedException(
+			    "Cannot VACUUM table \"%s\": compacting tables with indexes is not supported", tbl->name);
+		}
+	} else {
+		// tables with indexes are skipped
+		// we scan the set of committed tables, as the checkpoint does
+		// scanning for the transaction would create the default views of the internal schemas in the transaction
+		vector<reference<SchemaCatalogEntry>> schemas;
+		catalog.Cast<DuckCatalog>().ScanSchemas([&](SchemaCatalogEntry &schema) { schemas.push_back(schema); });
+		for (auto &schema : schemas) {
+			schema.get().Scan(CatalogType::TABLE_ENTRY,
+			                  [&](CatalogEntry &entry) { RequestVacuum(entry.Cast<TableCatalogEntry>()); });
+		}
+	}
+	DuckTransactionManager::Get(db).Vacuum(client);
 	return SourceResultType::FINISHED;
 }
 
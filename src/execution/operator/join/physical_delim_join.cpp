@@ -1,6 +1,11 @@
 #include "duckdb/execution/operator/join/physical_delim_join.hpp"
 
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -26,4 +31,213 @@ string PhysicalDelimJoin::ParamsToString() const {
 	return join->ParamsToString();
 }
 
+//===--------------------------------------------------------------------===//
+// Filter Pushdown
+//===--------------------------------------------------------------------===//
+DelimJoinFilterColumn::DelimJoinFilterColumn(idx_t sink_column_index, const LogicalType &type)
+    : sink_column_index(sink_column_index), type(type), stats(BaseStatistics::CreateEmpty(type)), has_null(false),
+      collect_values(InFilter::SupportsType(type) && type.id() != LogicalTypeId::ENUM) {
+}
+
+DelimJoinFilterState::DelimJoinFilterState(const PhysicalDelimJoin &op) : hashes(LogicalType::HASH) {
+	auto &sink_types = op.children[0]->GetTypes();
+	for (auto &target : op.filter_targets) {
+		idx_t column_idx;
+		for (column_idx = 0; column_idx < columns.size(); column_idx++) {
+			if (columns[column_idx].sink_column_index == target.sink_column_index) {
+				break;
+			}
+		}
+		if (column_idx == columns.size()) {
+			columns.emplace_back(target.sink_column_index, sink_types[target.sink_column_index]);
+		}
+		target_columns.push_back(column_idx);
+	}
+}
+
+static void AddFilterValue(DelimJoinFilterColumn &column, hash_t hash, const Value &value) {
+	if (column.values.size() >= DelimJoinFilterState::MAX_IN_FILTER_VALUES) {
+		// too many values: only the min/max is pushed
+		column.collect_values = false;
+		column.values.clear();
+		column.value_map.clear();
+		column.value_chain.clear();
+		return;
+	}
+	// values with the same hash are chained
+	auto entry = column.value_map.find(hash);
+	column.value_chain.push_back(entry == column.value_map.end() ? DConstants::INVALID_INDEX : entry->second);
+	column.value_map[hash] = column.values.size();
+	column.values.push_back(value);
+}
+
+template <class T>
+static void TemplatedCollectValues(DelimJoinFilterColumn &column, Vector &input, UnifiedVectorFormat &vdata,
+                                   UnifiedVectorFormat &hdata, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count && column.collect_values; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		auto entry = column.value_map.find(hash);
+		auto value_idx = entry == column.value_map.end() ? DConstants::INVALID_INDEX : entry->second;
+		for (; value_idx != DConstants::INVALID_INDEX; value_idx = column.value_chain[value_idx]) {
+			if (Equals::Operation<T>(data[idx], column.values[value_idx].GetValueUnsafe<T>())) {
+				break;
+			}
+		}
+		if (value_idx != DConstants::INVALID_INDEX) {
+			continue;
+		}
+		AddFilterValue(column, hash, input.GetValue(i));
+	}
+}
+
+static void CollectValues(DelimJoinFilterColumn &column, Vector &input, UnifiedVectorFormat &vdata,
+                          UnifiedVectorFormat &hdata, idx_t count) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedCollectValues<bool>(column, input, vdata, hdata, count);
+	case PhysicalType::INT8:
+		return TemplatedCollectValues<int8_t>(column, input, vdata, hdata, count);
+	case PhysicalType::INT16:
+		return TemplatedCollectValues<int16_t>(column, input, vdata, hdata, count);
+	case PhysicalType::INT32:
+		return TemplatedCollectValues<int32_t>(column, input, vdata, hdata, count);
+	case PhysicalType::INT64:
+		return TemplatedCollectValues<int64_t>(column, input, vdata, hdata, count);
+	case PhysicalType::INT128:
+		return TemplatedCollectValues<hugeint_t>(column, input, vdata, hdata, count);
+	case PhysicalType::UINT8:
+		return TemplatedCollectValues<uint8_t>(column, input, vdata, hdata, count);
+	case PhysicalType::UINT16:
+		return TemplatedCollectValues<uint16_t>(column, input, vdata, hdata, count);
+	case PhysicalType::UINT32:
+		return TemplatedCollectValues<uint32_t>(column, input, vdata, hdata, count);
+	case PhysicalType::UINT64:
+		return TemplatedCollectValues<uint64_t>(column, input, vdata, hdata, count);
+	case PhysicalType::UINT128:
+		return TemplatedCollectValues<uhugeint_t>(column, input, vdata, hdata, count);
+	case PhysicalType::FLOAT:
+		return TemplatedCollectValues<float>(column, input, vdata, hdata, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedCollectValues<double>(column, input, vdata, hdata, count);
+	case PhysicalType::VARCHAR:
+		return TemplatedCollectValues<string_t>(column, input, vdata, hdata, count);
+	default:
+		throw InternalException("Unsupported type for delim join filter pushdown");
+	}
+}
+
+void DelimJoinFilterState::Sink(DataChunk &chunk) {
+	const auto count = chunk.size();
+	for (auto &column : columns) {
+		auto &input = chunk.data[column.sink_column_index];
+		UnifiedVectorFormat vdata;
+		input.ToUnifiedFormat(count, vdata);
+		if (!column.has_null && !vdata.validity.AllValid()) {
+			for (idx_t i = 0; i < count; i++) {
+				if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+					column.has_null = true;
+					break;
+				}
+			}
+		}
+		if (PhysicalHashJoin::CanPushJoinFilter(column.type)) {
+			PhysicalHashJoin::UpdateKeyStatistics(column.stats, input, count);
+		}
+		if (column.collect_values) {
+			VectorOperations::Hash(input, hashes, count);
+			UnifiedVectorFormat hdata;
+			hashes.ToUnifiedFormat(count, hdata);
+			CollectValues(column, input, vdata, hdata, count);
+		}
+	}
+}
+
+void DelimJoinFilterState::Combine(DelimJoinFilterState &other) {
+	D_ASSERT(columns.size() == other.columns.size());
+	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
+		auto &column = columns[column_idx];
+		auto &other_column = other.columns[column_idx];
+		column.stats.Merge(other_column.stats);
+		column.has_null = column.has_null || other_column.has_null;
+		if (!other_column.collect_values) {
+			column.collect_values = false;
+			column.values.clear();
+			column.value_map.clear();
+			column.value_chain.clear();
+		}
+		if (!column.collect_values) {
+			continue;
+		}
+		for (auto &entry : other_column.value_map) {
+			auto other_idx = entry.second;
+			for (; other_idx != DConstants::INVALID_INDEX && column.collect_values;
+			     other_idx = other_column.value_chain[other_idx]) {
+				auto &value = other_column.values[other_idx];
+				auto existing = column.value_map.find(entry.first);
+				auto value_idx = existing == column.value_map.end() ? DConstants::INVALID_INDEX : existing->second;
+				for (; value_idx != DConstants::INVALID_INDEX; value_idx = column.value_chain[value_idx]) {
+					if (Value::NotDistinctFrom(column.values[value_idx], value)) {
+						break;
+					}
+				}
+				if (value_idx == DConstants::INVALID_INDEX) {
+					AddFilterValue(column, entry.first, value);
+				}
+			}
+			if (!column.collect_values) {
+				break;
+			}
+		}
+	}
+}
+
+void DelimJoinFilterState::PushFilters(const PhysicalDelimJoin &op) {
+	for (auto &target : op.filter_targets) {
+		target.dynamic_filters->ClearFilters(op);
+	}
+	for (idx_t target_idx = 0; target_idx < op.filter_targets.size(); target_idx++) {
+		auto &target = op.filter_targets[target_idx];
+		auto &column = columns[target_columns[target_idx]];
+		if (column.has_null && target.null_values_are_equal) {
+			// NULL values in the scan can find a match
+			continue;
+		}
+		auto &dynamic_filters = *target.dynamic_filters;
+		if (column.collect_values) {
+			if (column.values.empty()) {
+				// the duplicate eliminated side has no (non-NULL) values
+				continue;
+			}
+			// rows whose value does not occur in the duplicate eliminated side can never find a match
+			if (column.values.size() == 1) {
+				dynamic_filters.PushFilter(op, target.scan_column_index,
+				                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, column.values[0]));
+			} else {
+				dynamic_filters.PushFilter(op, target.scan_column_index, make_uniq<InFilter>(column.values));
+			}
+			continue;
+		}
+		if (!PhysicalHashJoin::CanPushJoinFilter(column.type) || !NumericStats::HasMinMax(column.stats)) {
+			continue;
+		}
+		auto min_val = NumericStats::Min(column.stats);
+		auto max_val = NumericStats::Max(column.stats);
+		if (min_val > max_val) {
+			continue;
+		}
+		dynamic_filters.PushFilter(
+		    op, target.scan_column_index,
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+		dynamic_filters.PushFilter(
+		    op, target.scan_column_index,
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
+	}
+}
+
 } // namespace duckdb
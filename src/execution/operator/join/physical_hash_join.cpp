@@ -13,7 +13,9 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -103,6 +105,14 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			// filters of a previous execution of this operator must not be applied
+			op.filter_pushdown->dynamic_filters->ClearFilters(op);
+			for (auto &col : op.filter_pushdown->columns) {
+				key_stats.push_back(BaseStatistics::CreateEmpty(op.condition_types[col.join_condition]));
+			}
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +146,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Min/max of the build keys for which filters are pushed into the probe side
+	vector<BaseStatistics> key_stats;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +168,12 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			for (auto &col : op.filter_pushdown->columns) {
+				key_stats.push_back(BaseStatistics::CreateEmpty(op.condition_types[col.join_condition]));
+			}
+		}
 	}
 
 public:
@@ -168,6 +187,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! Thread-local min/max of the build keys for which filters are pushed into the probe side
+	vector<BaseStatistics> key_stats;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -232,6 +254,72 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 	return make_uniq<HashJoinLocalSinkState>(*this, context.client);
 }
 
+template <class T>
+static void TemplatedUpdateKeyStatistics(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	T min;
+	T max;
+	bool has_value = false;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (!has_value) {
+			min = data[idx];
+			max = data[idx];
+			has_value = true;
+		} else {
+			NumericStats::UpdateValue<T>(data[idx], min, max);
+		}
+	}
+	if (has_value) {
+		NumericStats::Update<T>(stats, min);
+		NumericStats::Update<T>(stats, max);
+	}
+}
+
+void PhysicalHashJoin::UpdateKeyStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedUpdateKeyStatistics<int8_t>(stats, vdata, count);
+	case PhysicalType::INT16:
+		return TemplatedUpdateKeyStatistics<int16_t>(stats, vdata, count);
+	case PhysicalType::INT32:
+		return TemplatedUpdateKeyStatistics<int32_t>(stats, vdata, count);
+	case PhysicalType::INT64:
+		return TemplatedUpdateKeyStatistics<int64_t>(stats, vdata, count);
+	case PhysicalType::INT128:
+		return TemplatedUpdateKeyStatistics<hugeint_t>(stats, vdata, count);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateKeyStatistics<uint8_t>(stats, vdata, count);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateKeyStatistics<uint16_t>(stats, vdata, count);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateKeyStatistics<uint32_t>(stats, vdata, count);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateKeyStatistics<uint64_t>(stats, vdata, count);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateKeyStatistics<uhugeint_t>(stats, vdata, count);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateKeyStatistics<float>(stats, vdata, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateKeyStatistics<double>(stats, vdata, count);
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
+bool PhysicalHashJoin::CanPushJoinFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	return TypeIsNumeric(type.InternalType()) &&
+	       BaseStatistics::GetStatsType(type) == StatisticsType::NUMERIC_STATS;
+}
+
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
@@ -239,6 +327,13 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	if (filter_pushdown) {
+		for (idx_t i = 0; i < filter_pushdown->columns.size(); i++) {
+			auto &keys = lstate.join_keys.data[filter_pushdown->columns[i].join_condition];
+			UpdateKeyStatistics(lstate.key_stats[i], keys, lstate.join_keys.size());
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -259,7 +354,10 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 		auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
 		if (++gstate.temporary_memory_update_count % gstate.num_threads == 0) {
 			auto &sink_collection = lstate.hash_table->GetSinkCollection();
-			auto ht_size = sink_collection.SizeInBytes() + JoinHashTable::PointerTableSize(sink_collection.Count());
+			idx_t ht_size = 0;
+			for (auto &partition : sink_collection.GetPartitions()) {
+				ht_size += partition->SizeInBytes() + JoinHashTable::PartitionPointerTableSize(partition->Count());
+			}
 			gstate.temporary_memory_state->SetRemainingSize(context.client, gstate.num_threads * ht_size);
 		}
 	}
@@ -274,6 +372,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t i = 0; i < lstate.key_stats.size(); i++) {
+			gstate.key_stats[i].Merge(lstate.key_stats[i]);
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
@@ -288,19 +389,30 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 class HashJoinFinalizeTask : public ExecutorTask {
 public:
 	HashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink_p,
-	                     idx_t chunk_idx_from_p, idx_t chunk_idx_to_p, bool parallel_p)
-	    : ExecutorTask(context, std::move(event_p)), sink(sink_p), chunk_idx_from(chunk_idx_from_p),
-	      chunk_idx_to(chunk_idx_to_p), parallel(parallel_p) {
+	                     idx_t entry_idx_from_p, idx_t entry_idx_to_p, idx_t chunk_idx_from_p, idx_t chunk_idx_to_p,
+	                     bool parallel_p)
+	    : ExecutorTask(context, std::move(event_p)), sink(sink_p), entry_idx_from(entry_idx_from_p),
+	      entry_idx_to(entry_idx_to_p), chunk_idx_from(chunk_idx_from_p), chunk_idx_to(chunk_idx_to_p),
+	      parallel(parallel_p) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
-		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
+		if (entry_idx_from != entry_idx_to) {
+			sink.hash_table->InitializePointerTable(entry_idx_from, entry_idx_to);
+		}
+		if (chunk_idx_from != chunk_idx_to) {
+			sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
 
 private:
 	HashJoinGlobalSinkState &sink;
+	//! The entries of the pointer table to initialize
+	idx_t entry_idx_from;
+	idx_t entry_idx_to;
+	//! The chunks of the data collection to insert
 	idx_t chunk_idx_from;
 	idx_t chunk_idx_to;
 	bool parallel;
@@ -308,11 +420,17 @@ private:
 
 class HashJoinFinalizeEvent : public BasePipelineEvent {
 public:
-	HashJoinFinalizeEvent(Pipeline &pipeline_p, HashJoinGlobalSinkState &sink)
-	    : BasePipelineEvent(pipeline_p), sink(sink) {
+	HashJoinFinalizeEvent(Pipeline &pipeline_p, HashJoinGlobalSinkState &sink, vector<idx_t> large_partitions_p = {})
+	    : BasePipelineEvent(pipeline_p), sink(sink), large_partitions(std::move(large_partitions_p)),
+	      insert_large_partitions(!large_partitions.empty()) {
 	}
 
 	HashJoinGlobalSinkState &sink;
+	//! Partitions that have more chunks than a single task should insert. These are initialized by the first
+	//! event, and inserted into by a second event, with multiple tasks per partition
+	vector<idx_t> large_partitions;
+	//! Whether this is the second event
+	bool insert_large_partitions;
 
 public:
 	void Schedule() override {
@@ -322,35 +440,93 @@ public:
 		auto &ht = *sink.hash_table;
 		const auto chunk_count = ht.GetDataCollection().ChunkCount();
 		const auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		const auto &chunk_offsets = ht.GetPartitionChunkOffsets();
+		const auto &entry_offsets = ht.GetPartitionEntryOffsets();
 		if (num_threads == 1 || (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
 			// Single-threaded finalize
-			finalize_tasks.push_back(
-			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, chunk_count, false));
-		} else {
-			// Parallel finalize
-			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
-
-			idx_t chunk_idx = 0;
-			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
-				auto chunk_idx_from = chunk_idx;
-				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
-				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
-				                                                         chunk_idx_from, chunk_idx_to, true));
-				chunk_idx = chunk_idx_to;
-				if (chunk_idx == chunk_count) {
-					break;
+			finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U,
+			                                                         entry_offsets.back(), 0U, chunk_count, false));
+			SetTasks(std::move(finalize_tasks));
+			return;
+		}
+
+		// Parallel finalize
+		const auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+		if (insert_large_partitions) {
+			// multiple tasks insert into the (already initialized) region of each large partition concurrently
+			for (auto &partition_idx : large_partitions) {
+				const auto partition_chunk_to = chunk_offsets[partition_idx + 1];
+				for (auto chunk_idx = chunk_offsets[partition_idx]; chunk_idx < partition_chunk_to;
+				     chunk_idx += chunks_per_thread) {
+					const auto chunk_idx_to = MinValue<idx_t>(chunk_idx + chunks_per_thread, partition_chunk_to);
+					finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, 0U,
+					                                                         chunk_idx, chunk_idx_to, true));
+				}
+			}
+			SetTasks(std::move(finalize_tasks));
+			return;
+		}
+
+		// consecutive partitions are grouped into tasks that initialize and insert into their own regions of the
+		// pointer table, so they do not need to synchronize with any other task
+		const auto partition_count = ht.PointerTablePartitionCount();
+		idx_t group_start = 0;
+		for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+			const auto partition_chunks = chunk_offsets[partition_idx + 1] - chunk_offsets[partition_idx];
+			if (partition_chunks <= chunks_per_thread) {
+				if (chunk_offsets[partition_idx + 1] - chunk_offsets[group_start] > chunks_per_thread) {
+					// the group is full: start a new group with this partition
+					ScheduleGroup(finalize_tasks, group_start, partition_idx);
+					group_start = partition_idx;
 				}
+				continue;
 			}
+			// this partition is too large for a single task: split the initialization of its region over tasks
+			ScheduleGroup(finalize_tasks, group_start, partition_idx);
+			large_partitions.push_back(partition_idx);
+			const auto partition_entry_to = entry_offsets[partition_idx + 1];
+			const auto tasks_per_partition = (partition_chunks + chunks_per_thread - 1) / chunks_per_thread;
+			const auto entries_per_task = MaxValue<idx_t>(
+			    (partition_entry_to - entry_offsets[partition_idx] + tasks_per_partition - 1) / tasks_per_partition, 1);
+			for (auto entry_idx = entry_offsets[partition_idx]; entry_idx < partition_entry_to;
+			     entry_idx += entries_per_task) {
+				const auto entry_idx_to = MinValue<idx_t>(entry_idx + entries_per_task, partition_entry_to);
+				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, entry_idx,
+				                                                         entry_idx_to, 0U, 0U, false));
+			}
+			group_start = partition_idx + 1;
 		}
+		ScheduleGroup(finalize_tasks, group_start, partition_count);
 		SetTasks(std::move(finalize_tasks));
 	}
 
 	void FinishEvent() override {
+		if (!insert_large_partitions && !large_partitions.empty()) {
+			// the regions of the large partitions are initialized: now insert into them
+			auto new_event = make_shared_ptr<HashJoinFinalizeEvent>(*pipeline, sink, std::move(large_partitions));
+			this->InsertEvent(std::move(new_event));
+			return;
+		}
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
+
+private:
+	//! Schedule a task that initializes and inserts the partitions [partition_idx_from, partition_idx_to)
+	void ScheduleGroup(vector<shared_ptr<Task>> &finalize_tasks, idx_t partition_idx_from, idx_t partition_idx_to) {
+		if (partition_idx_from == partition_idx_to) {
+			return;
+		}
+		auto &context = pipeline->GetClientContext();
+		auto &ht = *sink.hash_table;
+		const auto &chunk_offsets = ht.GetPartitionChunkOffsets();
+		const auto &entry_offsets = ht.GetPartitionEntryOffsets();
+		finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(
+		    shared_from_this(), context, sink, entry_offsets[partition_idx_from], entry_offsets[partition_idx_to],
+		    chunk_offsets[partition_idx_from], chunk_offsets[partition_idx_to], false));
+	}
 };
 
 void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event) {
@@ -358,7 +534,8 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 		hash_table->finalized = true;
 		return;
 	}
-	hash_table->InitializePointerTable();
+	// the entries of the pointer table are initialized by the finalize tasks
+	hash_table->AllocatePointerTable();
 	auto new_event = make_shared_ptr<HashJoinFinalizeEvent>(pipeline, *this);
 	event.InsertEvent(std::move(new_event));
 }
@@ -448,18 +625,52 @@ public:
 		idx_t max_partition_size;
 		idx_t max_partition_count;
 		sink.hash_table->GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
-		sink.temporary_memory_state->SetMinimumReservation(max_partition_size +
-		                                                   JoinHashTable::PointerTableSize(max_partition_count));
+		sink.temporary_memory_state->SetMinimumReservation(
+		    max_partition_size + JoinHashTable::PartitionPointerTableSize(max_partition_count));
 		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
 
+static void PushJoinFilters(const PhysicalHashJoin &op, HashJoinGlobalSinkState &sink) {
+	auto &dynamic_filters = *op.filter_pushdown->dynamic_filters;
+	dynamic_filters.ClearFilters(op);
+	for (idx_t i = 0; i < op.filter_pushdown->columns.size(); i++) {
+		auto &stats = sink.key_stats[i];
+		if (!NumericStats::HasMinMax(stats)) {
+			continue;
+		}
+		auto min_val = NumericStats::Min(stats);
+		auto max_val = NumericStats::Max(stats);
+		if (min_val > max_val) {
+			// the build side has no (non-NULL) keys
+			continue;
+		}
+		// probe rows outside of the key range of the build side can never find a match
+		auto column_index = op.filter_pushdown->columns[i].probe_column_index;
+		if (min_val == max_val) {
+			dynamic_filters.PushFilter(op, column_index,
+			                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val)));
+		} else {
+			dynamic_filters.PushFilter(
+			    op, column_index,
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+			dynamic_filters.PushFilter(
+			    op, column_index,
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
+		}
+	}
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (filter_pushdown) {
+		PushJoinFilters(*this, sink);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -467,7 +678,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 
 	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
 	if (sink.external) {
-		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
+		const auto max_partition_ht_size =
+		    max_partition_size + JoinHashTable::PartitionPointerTableSize(max_partition_count);
 		// External Hash Join
 		sink.perfect_join_executor.reset();
 		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
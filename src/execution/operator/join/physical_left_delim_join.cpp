@@ -33,32 +33,39 @@ PhysicalLeftDelimJoin::PhysicalLeftDelimJoin(vector<LogicalType> types, unique_p
 class LeftDelimJoinGlobalState : public GlobalSinkState {
 public:
 	explicit LeftDelimJoinGlobalState(ClientContext &context, const PhysicalLeftDelimJoin &delim_join)
-	    : lhs_data(context, delim_join.children[0]->GetTypes()) {
+	    : lhs_data(context, delim_join.children[0]->GetTypes()), filter_state(delim_join) {
 		D_ASSERT(!delim_join.delim_scans.empty());
 		// set up the delim join chunk to scan in the original join
 		auto &cached_chunk_scan = delim_join.join->children[0]->Cast<PhysicalColumnDataScan>();
 		cached_chunk_scan.collection = &lhs_data;
+		for (auto &target : delim_join.filter_targets) {
+			target.dynamic_filters->ClearFilters(delim_join);
+		}
 	}
 
 	ColumnDataCollection lhs_data;
 	mutex lhs_lock;
+	//! The values that are pushed into the table scans of the RHS
+	DelimJoinFilterState filter_state;
 
-	void Merge(ColumnDataCollection &input) {
+	void Merge(ColumnDataCollection &input, DelimJoinFilterState &input_filter_state) {
 		lock_guard<mutex> guard(lhs_lock);
 		lhs_data.Combine(input);
+		filter_state.Combine(input_filter_state);
 	}
 };
 
 class LeftDelimJoinLocalState : public LocalSinkState {
 public:
 	explicit LeftDelimJoinLocalState(ClientContext &context, const PhysicalLeftDelimJoin &delim_join)
-	    : lhs_data(context, delim_join.children[0]->GetTypes()) {
+	    : lhs_data(context, delim_join.children[0]->GetTypes()), filter_state(delim_join) {
 		lhs_data.InitializeAppend(append_state);
 	}
 
 	unique_ptr<LocalSinkState> distinct_state;
 	ColumnDataCollection lhs_data;
 	ColumnDataAppendState append_state;
+	DelimJoinFilterState filter_state;
 
 	void Append(DataChunk &input) {
 		lhs_data.Append(input);
@@ -83,6 +90,9 @@ unique_ptr<LocalSinkState> PhysicalLeftDelimJoin::GetLocalSinkState(ExecutionCon
 SinkResultType PhysicalLeftDelimJoin::Sink(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
+	if (!filter_targets.empty()) {
+		lstate.filter_state.Sink(chunk);
+	}
 	lstate.lhs_data.Append(lstate.append_state, chunk);
 	OperatorSinkInput distinct_sink_input {*distinct->sink_state, *lstate.distinct_state, input.interrupt_state};
 	distinct->Sink(context, chunk, distinct_sink_input);
@@ -92,7 +102,7 @@ SinkResultType PhysicalLeftDelimJoin::Sink(ExecutionContext &context, DataChunk
 SinkCombineResultType PhysicalLeftDelimJoin::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
 	auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
-	gstate.Merge(lstate.lhs_data);
+	gstate.Merge(lstate.lhs_data, lstate.filter_state);
 
 	OperatorSinkCombineInput distinct_combine_input {*distinct->sink_state, *lstate.distinct_state,
 	                                                 input.interrupt_state};
@@ -108,6 +118,11 @@ SinkFinalizeType PhysicalLeftDelimJoin::Finalize(Pipeline &pipeline, Event &even
 
 	OperatorSinkFinalizeInput finalize_input {*distinct->sink_state, input.interrupt_state};
 	distinct->Finalize(pipeline, event, client, finalize_input);
+
+	if (!filter_targets.empty()) {
+		auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
+		gstate.filter_state.PushFilters(*this);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -131,6 +146,11 @@ void PhysicalLeftDelimJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta
 		state.delim_join_dependencies.insert(
 		    make_pair(delim_scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
 	}
+	// the same holds for the scans on the RHS that are filtered with the values of the duplicate eliminated data
+	for (auto &target : filter_targets) {
+		state.delim_join_dependencies.insert(
+		    make_pair(target.scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
+	}
 	join->BuildPipelines(current, meta_pipeline);
 }
 
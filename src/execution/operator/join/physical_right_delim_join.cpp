@@ -27,16 +27,31 @@ PhysicalRightDelimJoin::PhysicalRightDelimJoin(vector<LogicalType> types, unique
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
-class RightDelimJoinGlobalState : public GlobalSinkState {};
+class RightDelimJoinGlobalState : public GlobalSinkState {
+public:
+	explicit RightDelimJoinGlobalState(const PhysicalRightDelimJoin &delim_join) : filter_state(delim_join) {
+		for (auto &target : delim_join.filter_targets) {
+			target.dynamic_filters->ClearFilters(delim_join);
+		}
+	}
+
+	mutex lock;
+	//! The values that are pushed into the table scans of the LHS
+	DelimJoinFilterState filter_state;
+};
 
 class RightDelimJoinLocalState : public LocalSinkState {
 public:
+	explicit RightDelimJoinLocalState(const PhysicalRightDelimJoin &delim_join) : filter_state(delim_join) {
+	}
+
 	unique_ptr<LocalSinkState> join_state;
 	unique_ptr<LocalSinkState> distinct_state;
+	DelimJoinFilterState filter_state;
 };
 
 unique_ptr<GlobalSinkState> PhysicalRightDelimJoin::GetGlobalSinkState(ClientContext &context) const {
-	auto state = make_uniq<RightDelimJoinGlobalState>();
+	auto state = make_uniq<RightDelimJoinGlobalState>(*this);
 	join->sink_state = join->GetGlobalSinkState(context);
 	distinct->sink_state = distinct->GetGlobalSinkState(context);
 	if (delim_scans.size() > 1) {
@@ -46,7 +61,7 @@ unique_ptr<GlobalSinkState> PhysicalRightDelimJoin::GetGlobalSinkState(ClientCon
 }
 
 unique_ptr<LocalSinkState> PhysicalRightDelimJoin::GetLocalSinkState(ExecutionContext &context) const {
-	auto state = make_uniq<RightDelimJoinLocalState>();
+	auto state = make_uniq<RightDelimJoinLocalState>(*this);
 	state->join_state = join->GetLocalSinkState(context);
 	state->distinct_state = distinct->GetLocalSinkState(context);
 	return std::move(state);
@@ -55,6 +70,9 @@ unique_ptr<LocalSinkState> PhysicalRightDelimJoin::GetLocalSinkState(ExecutionCo
 SinkResultType PhysicalRightDelimJoin::Sink(ExecutionContext &context, DataChunk &chunk,
                                             OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<RightDelimJoinLocalState>();
+	if (!filter_targets.empty()) {
+		lstate.filter_state.Sink(chunk);
+	}
 
 	OperatorSinkInput join_sink_input {*join->sink_state, *lstate.join_state, input.interrupt_state};
 	join->Sink(context, chunk, join_sink_input);
@@ -76,6 +94,11 @@ SinkCombineResultType PhysicalRightDelimJoin::Combine(ExecutionContext &context,
 	                                                 input.interrupt_state};
 	distinct->Combine(context, distinct_combine_input);
 
+	if (!filter_targets.empty()) {
+		auto &gstate = input.global_state.Cast<RightDelimJoinGlobalState>();
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.filter_state.Combine(lstate.filter_state);
+	}
 	return SinkCombineResultType::FINISHED;
 }
 
@@ -90,6 +113,10 @@ SinkFinalizeType PhysicalRightDelimJoin::Finalize(Pipeline &pipeline, Event &eve
 	OperatorSinkFinalizeInput distinct_finalize_input {*distinct->sink_state, input.interrupt_state};
 	distinct->Finalize(pipeline, event, client, distinct_finalize_input);
 
+	if (!filter_targets.empty()) {
+		auto &gstate = input.global_state.Cast<RightDelimJoinGlobalState>();
+		gstate.filter_state.PushFilters(*this);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -113,6 +140,11 @@ void PhysicalRightDelimJoin::BuildPipelines(Pipeline &current, MetaPipeline &met
 		state.delim_join_dependencies.insert(
 		    make_pair(delim_scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
 	}
+	// the same holds for the scans on the LHS that are filtered with the values of the duplicate eliminated data
+	for (auto &target : filter_targets) {
+		state.delim_join_dependencies.insert(
+		    make_pair(target.scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
+	}
 
 	// Build join pipelines without building the RHS (already built in the Sink of this op)
 	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *join, false);
@@ -0,0 +1,107 @@
+#include "duckdb/execution/operator/scan/physical_late_materialization.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+class LateMaterializationState : public OperatorState {
+public:
+	LateMaterializationState(ClientContext &context, const vector<LogicalType> &types)
+	    : base_row_ids(LogicalType::ROW_TYPE), local_row_ids(LogicalType::ROW_TYPE) {
+		base_chunk.Initialize(context, types);
+		local_chunk.Initialize(context, types);
+	}
+
+	ColumnFetchState fetch_state;
+	//! Row ids of rows stored in the table itself and in the transaction-local storage
+	Vector base_row_ids;
+	Vector local_row_ids;
+	//! The fetched rows - the output chunk references these if rows from both storages are mixed
+	DataChunk base_chunk;
+	DataChunk local_chunk;
+};
+
+PhysicalLateMaterialization::PhysicalLateMaterialization(vector<LogicalType> types, DuckTableEntry &table,
+                                                         vector<column_t> column_ids, vector<string> names,
+                                                         idx_t row_id_index, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::LATE_MATERIALIZATION, std::move(types), estimated_cardinality),
+      table(table), column_ids(std::move(column_ids)), names(std::move(names)), row_id_index(row_id_index) {
+}
+
+unique_ptr<OperatorState> PhysicalLateMaterialization::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<LateMaterializationState>(context.client, types);
+}
+
+OperatorResultType PhysicalLateMaterialization::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                        GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<LateMaterializationState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+
+	const auto count = input.size();
+	auto &row_ids = input.data[row_id_index];
+	row_ids.Flatten(count);
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+
+	idx_t local_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (row_id_data[i] >= MAX_ROW_ID) {
+			local_count++;
+		}
+	}
+	if (local_count == 0) {
+		// all rows are stored in the table itself: fetch them directly into the result
+		storage.Fetch(transaction, chunk, column_ids, row_ids, count, state.fetch_state);
+	} else {
+		// some of the rows were appended by this transaction: fetch both sets of rows separately
+		// and restore the original order through a selection vector
+		auto base_ids = FlatVector::GetData<row_t>(state.base_row_ids);
+		auto local_ids = FlatVector::GetData<row_t>(state.local_row_ids);
+		const idx_t base_count = count - local_count;
+		SelectionVector sel(count);
+		idx_t base_idx = 0;
+		idx_t local_idx = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (row_id_data[i] >= MAX_ROW_ID) {
+				sel.set_index(i, base_count + local_idx);
+				local_ids[local_idx++] = row_id_data[i];
+			} else {
+				sel.set_index(i, base_idx);
+				base_ids[base_idx++] = row_id_data[i];
+			}
+		}
+		state.base_chunk.Reset();
+		state.local_chunk.Reset();
+		storage.Fetch(transaction, state.base_chunk, column_ids, state.base_row_ids, base_count, state.fetch_state);
+		auto &local_storage = LocalStorage::Get(transaction);
+		local_storage.FetchChunk(storage, state.local_row_ids, local_count, column_ids, state.local_chunk,
+		                         state.fetch_state);
+		if (state.base_chunk.size() != base_count || state.local_chunk.size() != local_count) {
+			throw InternalException("PhysicalLateMaterialization - failed to fetch all rows");
+		}
+		state.base_chunk.Append(state.local_chunk);
+		chunk.Slice(state.base_chunk, sel, count);
+	}
+	if (chunk.size() != count) {
+		throw InternalException("PhysicalLateMaterialization - failed to fetch all rows");
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+string PhysicalLateMaterialization::ParamsToString() const {
+	string result = table.name;
+	result += "\n[INFOSEPARATOR]\n";
+	for (idx_t i = 0; i < names.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += names[i];
+	}
+	return result;
+}
+
+} // namespace duckdb
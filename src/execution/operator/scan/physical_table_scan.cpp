@@ -2,6 +2,8 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -23,8 +25,11 @@ PhysicalTableScan::PhysicalTableScan(vector<LogicalType> types, TableFunction fu
 class TableScanGlobalSourceState : public GlobalSourceState {
 public:
 	TableScanGlobalSourceState(ClientContext &context, const PhysicalTableScan &op) {
+		if (op.dynamic_filters && op.dynamic_filters->HasFilters()) {
+			table_filters = op.dynamic_filters->GetFinalTableFilters(op.table_filters.get());
+		}
 		if (op.function.init_global) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, GetTableFilters(op));
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
 				max_threads = global_state->MaxThreads();
@@ -36,10 +41,16 @@ public:
 
 	idx_t max_threads = 0;
 	unique_ptr<GlobalTableFunctionState> global_state;
+	//! The static table filters combined with the dynamic filters at the time the scan started (if any)
+	unique_ptr<TableFilterSet> table_filters;
 
 	idx_t MaxThreads() override {
 		return max_threads;
 	}
+
+	optional_ptr<TableFilterSet> GetTableFilters(const PhysicalTableScan &op) const {
+		return table_filters ? table_filters.get() : op.table_filters.get();
+	}
 };
 
 class TableScanLocalSourceState : public LocalSourceState {
@@ -47,7 +58,8 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
+			                             gstate.GetTableFilters(op));
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -99,6 +111,19 @@ string PhysicalTableScan::GetName() const {
 	return StringUtil::Upper(function.name + " " + function.extra_info);
 }
 
+string PhysicalTableScan::FiltersToString(const TableFilterSet &filters) const {
+	string result;
+	for (auto &f : filters.filters) {
+		auto &column_index = f.first;
+		auto &filter = f.second;
+		if (column_index < names.size()) {
+			result += filter->ToString(names[column_ids[column_index]]);
+			result += "\n";
+		}
+	}
+	return result;
+}
+
 string PhysicalTableScan::ParamsToString() const {
 	string result;
 	if (function.to_string) {
@@ -130,15 +155,12 @@ string PhysicalTableScan::ParamsToString() const {
 	}
 	if (function.filter_pushdown && table_filters) {
 		result += "\n[INFOSEPARATOR]\n";
-		result += "Filters: ";
-		for (auto &f : table_filters->filters) {
-			auto &column_index = f.first;
-			auto &filter = f.second;
-			if (column_index < names.size()) {
-				result += filter->ToString(names[column_ids[column_index]]);
-				result += "\n";
-			}
-		}
+		result += "Filters: " + FiltersToString(*table_filters);
+	}
+	if (dynamic_filters && dynamic_filters->HasFilters()) {
+		// the filters that were pushed into the scan during execution (e.g., in EXPLAIN ANALYZE)
+		result += "\n[INFOSEPARATOR]\n";
+		result += "Dynamic Filters: " + FiltersToString(*dynamic_filters->GetFinalTableFilters(nullptr));
 	}
 	if (!extra_info.file_filters.empty()) {
 		result += "\n[INFOSEPARATOR]\n";
@@ -166,4 +188,15 @@ bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	return true;
 }
 
+void PhysicalTableScan::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	auto &state = meta_pipeline.GetState();
+	auto entry = state.delim_join_dependencies.find(*this);
+	if (entry != state.delim_join_dependencies.end()) {
+		// the scan is filtered with the duplicate eliminated data of a delim join, it has to wait for it to finish
+		auto delim_dependency = entry->second.get().shared_from_this();
+		current.AddDependency(delim_dependency);
+	}
+	PhysicalOperator::BuildPipelines(current, meta_pipeline);
+}
+
 } // namespace duckdb
@@ -1,14 +1,20 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 
@@ -149,6 +155,106 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static optional_ptr<BoundReferenceExpression> GetColumnReference(Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return &expr.Cast<BoundReferenceExpression>();
+	}
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	// compressed materialization maps every value to a distinct value, so it keeps equal values adjacent
+	// the integral variants take the minimum of the column as a second (constant) argument
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	auto &name = func.function.name;
+	const auto compressed =
+	    StringUtil::StartsWith(name, "__internal_compress") || StringUtil::StartsWith(name, "__internal_decompress");
+	if (!compressed || func.children.empty()) {
+		return nullptr;
+	}
+	for (idx_t child_idx = 1; child_idx < func.children.size(); child_idx++) {
+		if (!func.children[child_idx]->IsFoldable()) {
+			return nullptr;
+		}
+	}
+	return GetColumnReference(*func.children[0]);
+}
+
+static bool IsOrderedOnGroups(PhysicalOperator &plan, const vector<unique_ptr<Expression>> &groups) {
+	vector<idx_t> columns;
+	for (auto &group : groups) {
+		auto ref = GetColumnReference(*group);
+		if (!ref) {
+			return false;
+		}
+		columns.push_back(ref->index);
+	}
+
+	// follow the group columns down to a sort
+	optional_ptr<const vector<BoundOrderByNode>> orders;
+	reference<PhysicalOperator> child(plan);
+	while (!orders) {
+		auto &op = child.get();
+		switch (op.type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = op.Cast<PhysicalProjection>();
+			for (auto &column : columns) {
+				auto ref = GetColumnReference(*projection.select_list[column]);
+				if (!ref) {
+					return false;
+				}
+				column = ref->index;
+			}
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::ORDER_BY: {
+			auto &order = op.Cast<PhysicalOrder>();
+			for (auto &column : columns) {
+				column = order.projections[column];
+			}
+			orders = &order.orders;
+			break;
+		}
+		case PhysicalOperatorType::TOP_N:
+			orders = &op.Cast<PhysicalTopN>().orders;
+			break;
+		default:
+			return false;
+		}
+		child = *op.children[0];
+	}
+
+	// the leading sort keys have to be exactly the group columns
+	unordered_set<idx_t> remaining(columns.begin(), columns.end());
+	for (auto &order : *orders) {
+		if (remaining.empty()) {
+			break;
+		}
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		if (!remaining.erase(order.expression->Cast<BoundReferenceExpression>().index)) {
+			return false;
+		}
+	}
+	return remaining.empty();
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op, PhysicalOperator &plan) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			// distinct aggregates are not supported in streaming aggregates
+			return false;
+		}
+	}
+	return IsOrderedOnGroups(plan, op.groups);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -178,9 +284,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// stream the groups if the input is sorted on them, otherwise use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (CanUseStreamingAggregate(op, *plan)) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
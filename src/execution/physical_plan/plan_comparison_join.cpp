@@ -4,10 +4,12 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
@@ -129,6 +131,81 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+optional_ptr<PhysicalTableScan> PhysicalPlanGenerator::FindProbeTableScan(PhysicalOperator &op,
+                                                                         idx_t &column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_index = expr.Cast<BoundReferenceExpression>().index;
+		return FindProbeTableScan(*op.children[0], column_index);
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindProbeTableScan(*op.children[0], column_index);
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.function.filter_pushdown ||
+		    scan.function.global_initialization != TableFunctionInitialization::INITIALIZE_ON_EXECUTE) {
+			return nullptr;
+		}
+		if (!scan.projection_ids.empty()) {
+			column_index = scan.projection_ids[column_index];
+		}
+		if (scan.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		return &scan;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+static void PlanJoinFilterPushdown(ClientContext &context, PhysicalHashJoin &join) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.disabled_optimizers.find(OptimizerType::JOIN_FILTER_PUSHDOWN) !=
+	    config.options.disabled_optimizers.end()) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		// probe rows without a match are not emitted: they can be filtered out before reaching the join
+		break;
+	default:
+		return;
+	}
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	optional_ptr<PhysicalTableScan> probe_scan;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_REF ||
+		    !PhysicalHashJoin::CanPushJoinFilter(cond.left->return_type)) {
+			continue;
+		}
+		idx_t column_index = cond.left->Cast<BoundReferenceExpression>().index;
+		auto scan = PhysicalPlanGenerator::FindProbeTableScan(*join.children[0], column_index);
+		if (!scan || (probe_scan && probe_scan.get() != scan.get())) {
+			continue;
+		}
+		probe_scan = scan;
+		pushdown_info->columns.push_back(JoinFilterPushdownColumn {cond_idx, column_index});
+	}
+	if (!probe_scan) {
+		return;
+	}
+	if (!probe_scan->dynamic_filters) {
+		probe_scan->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	pushdown_info->dynamic_filters = probe_scan->dynamic_filters;
+	join.filter_pushdown = std::move(pushdown_info);
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -193,9 +270,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN && recursive_cte_tables.empty()) {
+			// runtime filters are not pushed through duplicate eliminated joins or into (recursive) CTEs, where the
+			// probe side may be scanned before (or more often than) the build side is finalized
+			PlanJoinFilterPushdown(context, *hash_join);
+		}
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
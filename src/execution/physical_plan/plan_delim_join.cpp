@@ -4,8 +4,11 @@
 #include "duckdb/execution/operator/join/physical_left_delim_join.hpp"
 #include "duckdb/execution/operator/join/physical_right_delim_join.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -18,6 +21,148 @@ static void GatherDelimScans(const PhysicalOperator &op, vector<const_reference<
 	}
 }
 
+//! Follows a column down to the duplicate eliminated scan that produces it (if any)
+static optional_ptr<const PhysicalOperator> FindDelimScan(const PhysicalOperator &op, idx_t &column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_index = expr.Cast<BoundReferenceExpression>().index;
+		return FindDelimScan(*op.children[0], column_index);
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindDelimScan(*op.children[0], column_index);
+	case PhysicalOperatorType::DELIM_SCAN:
+		return &op;
+	default:
+		return nullptr;
+	}
+}
+
+//! Whether rows of the given side of a join that do not find a match can be removed without changing the result
+static bool CanFilterJoinSide(JoinType join_type, idx_t side) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+		return true;
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return side == 0;
+	case JoinType::LEFT:
+	case JoinType::ANTI:
+	case JoinType::SINGLE:
+		return side == 1;
+	default:
+		return false;
+	}
+}
+
+//! Adds a filter target if the expression references a column of a table scan in the given operator
+static void AddDelimJoinFilterTarget(PhysicalOperator &op, Expression &expr, idx_t sink_column_index,
+                                     const LogicalType &sink_type, bool null_values_are_equal,
+                                     vector<DelimJoinFilterTarget> &targets) {
+	if (expr.type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	if (!PhysicalHashJoin::CanPushJoinFilter(sink_type) &&
+	    (!InFilter::SupportsType(sink_type) || sink_type.id() == LogicalTypeId::ENUM)) {
+		return;
+	}
+	idx_t column_index = expr.Cast<BoundReferenceExpression>().index;
+	auto scan = PhysicalPlanGenerator::FindProbeTableScan(op, column_index);
+	if (!scan || scan->returned_types[scan->column_ids[column_index]] != sink_type) {
+		return;
+	}
+	if (!scan->dynamic_filters) {
+		scan->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	targets.push_back(
+	    DelimJoinFilterTarget {*scan, scan->dynamic_filters, column_index, sink_column_index, null_values_are_equal});
+}
+
+//! Finds the table scans in the delim side that can be filtered with the values of the duplicate eliminated side:
+//! scans that are joined with a duplicate eliminated scan in the delim side
+static void GatherDelimJoinFilterTargets(PhysicalOperator &op,
+                                         const vector<const_reference<PhysicalOperator>> &delim_scans,
+                                         const vector<unique_ptr<Expression>> &delim_columns,
+                                         vector<DelimJoinFilterTarget> &targets) {
+	for (auto &child : op.children) {
+		GatherDelimJoinFilterTargets(*child, delim_scans, delim_columns, targets);
+	}
+	if (op.type != PhysicalOperatorType::HASH_JOIN) {
+		return;
+	}
+	auto &join = op.Cast<PhysicalHashJoin>();
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			continue;
+		}
+		for (idx_t delim_side = 0; delim_side < 2; delim_side++) {
+			auto &delim_expr = delim_side == 0 ? *cond.left : *cond.right;
+			auto &filter_expr = delim_side == 0 ? *cond.right : *cond.left;
+			if (delim_expr.type != ExpressionType::BOUND_REF || !CanFilterJoinSide(join.join_type, 1 - delim_side)) {
+				continue;
+			}
+			idx_t delim_column = delim_expr.Cast<BoundReferenceExpression>().index;
+			auto delim_scan = FindDelimScan(*join.children[delim_side], delim_column);
+			if (!delim_scan) {
+				continue;
+			}
+			bool is_delim_scan = false;
+			for (auto &scan : delim_scans) {
+				is_delim_scan = is_delim_scan || RefersToSameObject(scan.get(), *delim_scan);
+			}
+			if (!is_delim_scan) {
+				continue;
+			}
+			auto &sink_column = delim_columns[delim_column]->Cast<BoundReferenceExpression>();
+			AddDelimJoinFilterTarget(*join.children[1 - delim_side], filter_expr, sink_column.index,
+			                         sink_column.return_type,
+			                         cond.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM, targets);
+		}
+	}
+}
+
+//! Pushes the values of the duplicate eliminated side into the table scans of the delim side, either through the
+//! original join or through joins with the duplicate eliminated scans
+static vector<DelimJoinFilterTarget>
+PlanDelimJoinFilterPushdown(ClientContext &context, LogicalComparisonJoin &op, PhysicalOperator &plan,
+                            const vector<const_reference<PhysicalOperator>> &delim_scans) {
+	vector<DelimJoinFilterTarget> targets;
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.disabled_optimizers.find(OptimizerType::JOIN_FILTER_PUSHDOWN) !=
+	    config.options.disabled_optimizers.end()) {
+		return targets;
+	}
+	const idx_t delim_idx = op.delim_flipped ? 0 : 1;
+	const idx_t sink_idx = 1 - delim_idx;
+	if (plan.type == PhysicalOperatorType::HASH_JOIN) {
+		auto &join = plan.Cast<PhysicalHashJoin>();
+		if (CanFilterJoinSide(join.join_type, delim_idx)) {
+			for (auto &cond : join.conditions) {
+				if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+				    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+					continue;
+				}
+				auto &sink_expr = sink_idx == 0 ? *cond.left : *cond.right;
+				auto &filter_expr = sink_idx == 0 ? *cond.right : *cond.left;
+				if (sink_expr.type != ExpressionType::BOUND_REF) {
+					continue;
+				}
+				AddDelimJoinFilterTarget(*join.children[delim_idx], filter_expr,
+				                         sink_expr.Cast<BoundReferenceExpression>().index, sink_expr.return_type,
+				                         cond.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM, targets);
+			}
+		}
+	}
+	GatherDelimJoinFilterTargets(*plan.children[delim_idx], delim_scans, op.duplicate_eliminated_columns, targets);
+	return targets;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanDelimJoin(LogicalComparisonJoin &op) {
 	// first create the underlying join
 	auto plan = PlanComparisonJoin(op);
@@ -34,6 +179,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanDelimJoin(LogicalCompari
 		// just push the normal join
 		return plan;
 	}
+	vector<DelimJoinFilterTarget> filter_targets;
+	if (recursive_cte_tables.empty()) {
+		// the scans of a (recursive) CTE may run before (or more often than) the delim join is finished
+		filter_targets = PlanDelimJoinFilterPushdown(context, op, *plan, delim_scans);
+	}
 	vector<LogicalType> delim_types;
 	vector<unique_ptr<Expression>> distinct_groups, distinct_expressions;
 	for (auto &delim_expr : op.duplicate_eliminated_columns) {
@@ -50,6 +200,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanDelimJoin(LogicalCompari
 	} else {
 		delim_join = make_uniq<PhysicalLeftDelimJoin>(op.types, std::move(plan), delim_scans, op.estimated_cardinality);
 	}
+	delim_join->filter_targets = std::move(filter_targets);
 	// we still have to create the DISTINCT clause that is used to generate the duplicate eliminated chunk
 	delim_join->distinct = make_uniq<PhysicalHashAggregate>(context, delim_types, std::move(distinct_expressions),
 	                                                        std::move(distinct_groups), op.estimated_cardinality);
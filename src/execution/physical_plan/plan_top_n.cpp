@@ -1,12 +1,170 @@
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/scan/physical_late_materialization.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+unique_ptr<TableFilterSet> CreateTableFilterSet(TableFilterSet &table_filters, vector<column_t> &column_ids);
+
+//! Late materialization is only used if the Top-N emits at most this many rows
+static constexpr idx_t LATE_MATERIALIZATION_MAX_ROWS = 10000;
+
+static idx_t FindOrAddColumn(vector<column_t> &column_ids, column_t column_id) {
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		if (column_ids[i] == column_id) {
+			return i;
+		}
+	}
+	column_ids.push_back(column_id);
+	return column_ids.size() - 1;
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanLateMaterialization(LogicalTopN &op) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.disabled_optimizers.find(OptimizerType::LATE_MATERIALIZATION) !=
+	    config.options.disabled_optimizers.end()) {
+		return nullptr;
+	}
+	if (op.limit > LATE_MATERIALIZATION_MAX_ROWS || op.offset > LATE_MATERIALIZATION_MAX_ROWS - op.limit) {
+		return nullptr;
+	}
+	// look through a projection that only re-orders the columns of the scan
+	reference<LogicalOperator> child = *op.children[0];
+	vector<idx_t> projection_map;
+	if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		for (auto &expr : child.get().expressions) {
+			if (expr->type != ExpressionType::BOUND_REF) {
+				return nullptr;
+			}
+			projection_map.push_back(expr->Cast<BoundReferenceExpression>().index);
+		}
+		child = *child.get().children[0];
+	} else {
+		for (idx_t i = 0; i < op.types.size(); i++) {
+			projection_map.push_back(i);
+		}
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.children.empty() || !get.bind_data || get.function.name != "seq_scan" ||
+	    !get.function.projection_pushdown) {
+		return nullptr;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan) {
+		return nullptr;
+	}
+	auto get_column_id = [&](idx_t topn_idx) {
+		auto get_idx = projection_map[topn_idx];
+		return get.projection_ids.empty() ? get.column_ids[get_idx] : get.column_ids[get.projection_ids[get_idx]];
+	};
+
+	// figure out which columns are required to compute the Top-N
+	vector<idx_t> key_columns;
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			auto index = expr.Cast<BoundReferenceExpression>().index;
+			if (std::find(key_columns.begin(), key_columns.end(), index) == key_columns.end()) {
+				key_columns.push_back(index);
+			}
+		});
+	}
+	if (key_columns.size() >= op.types.size()) {
+		// all columns are required for the Top-N anyway
+		return nullptr;
+	}
+
+	// scan only the sort keys, the row ids and the filtered columns
+	vector<column_t> scan_column_ids;
+	vector<idx_t> scan_projection_ids;
+	vector<LogicalType> scan_types;
+	unordered_map<idx_t, idx_t> key_map;
+	auto add_scan_output = [&](column_t column_id) {
+		auto scan_idx = FindOrAddColumn(scan_column_ids, column_id);
+		for (idx_t i = 0; i < scan_projection_ids.size(); i++) {
+			if (scan_projection_ids[i] == scan_idx) {
+				return i;
+			}
+		}
+		scan_projection_ids.push_back(scan_idx);
+		scan_types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType(LogicalType::ROW_TYPE)
+		                                                           : get.returned_types[column_id]);
+		return scan_projection_ids.size() - 1;
+	};
+	for (auto &key_idx : key_columns) {
+		key_map[key_idx] = add_scan_output(get_column_id(key_idx));
+	}
+	auto row_id_index = add_scan_output(COLUMN_IDENTIFIER_ROW_ID);
+	for (auto &entry : get.table_filters.filters) {
+		FindOrAddColumn(scan_column_ids, entry.first);
+	}
+
+	// the fetch reads all columns that the Top-N emits
+	auto &table = bind_data.table;
+	vector<column_t> fetch_column_ids;
+	vector<string> fetch_names;
+	for (idx_t i = 0; i < op.types.size(); i++) {
+		auto column_id = get_column_id(i);
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			fetch_column_ids.push_back(column_id);
+			fetch_names.push_back("rowid");
+		} else {
+			fetch_column_ids.push_back(table.GetColumn(LogicalIndex(column_id)).StorageOid());
+			fetch_names.push_back(get.names[column_id]);
+		}
+	}
+
+	// rewrite the order expressions to reference the narrow scan
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type == ExpressionType::BOUND_REF) {
+				auto &bound_ref = expr.Cast<BoundReferenceExpression>();
+				bound_ref.index = key_map[bound_ref.index];
+			}
+		});
+	}
+
+	unique_ptr<TableFilterSet> table_filters;
+	if (!get.table_filters.filters.empty()) {
+		table_filters = CreateTableFilterSet(get.table_filters, scan_column_ids);
+	}
+	if (get.function.dependency) {
+		get.function.dependency(dependencies, get.bind_data.get());
+	}
+	auto scan = make_uniq<PhysicalTableScan>(scan_types, get.function, std::move(get.bind_data), get.returned_types,
+	                                         std::move(scan_column_ids), std::move(scan_projection_ids), get.names,
+	                                         std::move(table_filters), get.estimated_cardinality, get.extra_info);
+	auto top_n = make_uniq<PhysicalTopN>(std::move(scan_types), std::move(op.orders), NumericCast<idx_t>(op.limit),
+	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	top_n->children.push_back(std::move(scan));
+	auto fetch = make_uniq<PhysicalLateMaterialization>(op.types, table, std::move(fetch_column_ids),
+	                                                    std::move(fetch_names), row_id_index, op.estimated_cardinality);
+	fetch->children.push_back(std::move(top_n));
+	return std::move(fetch);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
+	auto late_materialization = PlanLateMaterialization(op);
+	if (late_materialization) {
+		return late_materialization;
+	}
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
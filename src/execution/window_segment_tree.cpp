@@ -6,6 +6,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 #include <utility>
@@ -243,7 +244,7 @@ void WindowConstantAggregator::Evaluate(WindowAggregatorState &lstate, const Dat
 //===--------------------------------------------------------------------===//
 WindowCustomAggregator::WindowCustomAggregator(AggregateObject aggr, const LogicalType &result_type,
                                                const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), build_ready(false) {
 }
 
 WindowCustomAggregator::~WindowCustomAggregator() {
@@ -310,9 +311,26 @@ void WindowCustomAggregator::Finalize(const FrameStats &stats) {
 
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), gcstate.allocator);
 		aggr.function.window_init(aggr_input_data, *partition_input, gcstate.state.data());
+
+		//	Let other threads that are waiting for the partition help with building the shared state
+		if (aggr.function.window_build) {
+			build_ready = true;
+			aggr.function.window_build(aggr_input_data, *partition_input, gcstate.state.data());
+		}
 	}
 }
 
+void WindowCustomAggregator::AssistFinalize() {
+	if (!build_ready) {
+		return;
+	}
+
+	auto &gcstate = gstate->Cast<WindowCustomAggregatorState>();
+	ArenaAllocator allocator(Allocator::DefaultAllocator());
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.window_build(aggr_input_data, *partition_input, gcstate.state.data());
+}
+
 unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetLocalState() const {
 	return make_uniq<WindowCustomAggregatorState>(aggr, exclude_mode);
 }
@@ -599,7 +617,8 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      build_ready(false), build_next(0), build_done(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -840,9 +859,6 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(inputs.ColumnCount() > 0);
 
-	//	Use a temporary scan state to build the tree
-	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
-
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
 	idx_t level_nodes = inputs.size();
@@ -853,31 +869,74 @@ void WindowSegmentTree::ConstructTree() {
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
 	levels_flat_start.push_back(0);
 
-	idx_t levels_flat_offset = 0;
+	// Corner case: single element in the window
+	if (inputs.size() <= 1) {
+		aggr.function.initialize(levels_flat_native.get());
+		return;
+	}
+
+	//	Split the levels into units of nodes that other threads can help to build.
+	//	level 0 is data itself, and each level can only be built once the one below is done.
+	build_units.push_back(0);
+	for (idx_t level_size = inputs.size(); level_size > 1; level_size = level_nodes) {
+		level_nodes = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		levels_flat_start.push_back(levels_flat_start.back() + level_nodes);
+		build_units.push_back(build_units.back() + (level_nodes + (BUILD_NODES - 1)) / BUILD_NODES);
+	}
+	build_ready = true;
+
+	//	Use a temporary scan state to build the tree
+	BuildTree(*gstate);
+
+	//	Wait for the units claimed by other threads
+	while (build_done < build_units.back()) {
+		TaskScheduler::YieldThread();
+	}
+}
+
+void WindowSegmentTree::BuildTree(WindowAggregatorState &lstate) {
+	auto &gtstate = lstate.Cast<WindowSegmentTreeState>().part;
+
+	const auto total_units = build_units.back();
 	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
+	for (auto unit_idx = build_next++; unit_idx < total_units; unit_idx = build_next++) {
+		//	Units are claimed in order, so the level below is being built by active threads
+		while (build_units[level_current + 1] <= unit_idx) {
+			++level_current;
+		}
+		while (build_done < build_units[level_current]) {
+			TaskScheduler::YieldThread();
+		}
+
+		const auto level_begin = levels_flat_start[level_current];
+		const auto level_nodes = levels_flat_start[level_current + 1] - level_begin;
+		const auto level_size = level_current ? level_begin - levels_flat_start[level_current - 1] : inputs.size();
+		const auto node_begin = (unit_idx - build_units[level_current]) * BUILD_NODES;
+		const auto node_end = MinValue(node_begin + BUILD_NODES, level_nodes);
+		for (auto node_idx = node_begin; node_idx < node_end; ++node_idx) {
 			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
+			data_ptr_t state_ptr = levels_flat_native.get() + ((level_begin + node_idx) * state_size);
 			aggr.function.initialize(state_ptr);
+			const auto pos = node_idx * TREE_FANOUT;
 			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
 			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
 		}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+		++build_done;
 	}
+}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+void WindowSegmentTree::AssistFinalize() {
+	if (!build_ready || build_next >= build_units.back()) {
+		return;
 	}
+
+	auto lstate = GetLocalState();
+	BuildTree(*lstate);
+
+	//	The nodes we built may reference memory in our allocator
+	lock_guard<mutex> build_guard(build_lock);
+	build_states.emplace_back(std::move(lstate));
 }
 
 void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
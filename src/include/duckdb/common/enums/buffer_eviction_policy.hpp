@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! LRU: a single queue, blocks are evicted in the order in which they were last unpinned
+//! TWO_QUEUE: per memory tag queues for blocks that were loaded once (probationary) and for blocks that were re-loaded
+//! shortly after being evicted (protected) - probationary blocks are evicted first, so scans cannot flush the hot set
+//! (as long as the protected blocks take up less than PROTECTED_MEMORY_PERCENTAGE of the memory limit)
+enum class BufferEvictionPolicy : uint8_t { LRU = 0, TWO_QUEUE = 1 };
+
+} // namespace duckdb
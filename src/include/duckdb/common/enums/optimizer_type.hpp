@@ -32,6 +32,8 @@ enum class OptimizerType : uint32_t {
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
 	REORDER_FILTER,
+	JOIN_FILTER_PUSHDOWN,
+	LATE_MATERIALIZATION,
 	EXTENSION
 };
 
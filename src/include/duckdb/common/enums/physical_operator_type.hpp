@@ -27,6 +27,7 @@ enum class PhysicalOperatorType : uint8_t {
 	UNGROUPED_AGGREGATE,
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
+	STREAMING_GROUP_BY,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
@@ -49,6 +50,7 @@ enum class PhysicalOperatorType : uint8_t {
 	DELIM_SCAN,
 	EXPRESSION_SCAN,
 	POSITIONAL_SCAN,
+	LATE_MATERIALIZATION,
 	// -----------------------------
 	// Joins
 	// -----------------------------
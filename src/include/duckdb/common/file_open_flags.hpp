@@ -26,6 +26,7 @@ public:
 	static constexpr idx_t FILE_FLAGS_PRIVATE = idx_t(1 << 6);
 	static constexpr idx_t FILE_FLAGS_NULL_IF_NOT_EXISTS = idx_t(1 << 7);
 	static constexpr idx_t FILE_FLAGS_PARALLEL_ACCESS = idx_t(1 << 8);
+	static constexpr idx_t FILE_FLAGS_IO_URING = idx_t(1 << 9);
 
 public:
 	FileOpenFlags() = default;
@@ -99,6 +100,9 @@ public:
 	inline bool RequireParallelAccess() const {
 		return flags & FILE_FLAGS_PARALLEL_ACCESS;
 	}
+	inline bool UseIOUring() const {
+		return flags & FILE_FLAGS_IO_URING;
+	}
 
 private:
 	idx_t flags = 0;
@@ -129,6 +133,8 @@ public:
 	//! Multiple threads may perform reads and writes in parallel
 	static constexpr FileOpenFlags FILE_FLAGS_PARALLEL_ACCESS =
 	    FileOpenFlags(FileOpenFlags::FILE_FLAGS_PARALLEL_ACCESS);
+	//! Submit batched reads through io_uring where it is available (Linux only)
+	static constexpr FileOpenFlags FILE_FLAGS_IO_URING = FileOpenFlags(FileOpenFlags::FILE_FLAGS_IO_URING);
 };
 
 } // namespace duckdb
@@ -51,6 +51,13 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A read of nr_bytes at a location in a file into a buffer, used to submit many reads at once
+struct FileReadRequest {
+	void *buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -61,6 +68,7 @@ public:
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadBatch(FileReadRequest *requests, idx_t count);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -116,6 +124,9 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Execute a batch of reads, each of which reads exactly nr_bytes from the specified location in the file. The
+	//! reads can be executed in any order (or concurrently). Fails if any of the reads fails.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
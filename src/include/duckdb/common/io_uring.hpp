@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_uring.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+struct IOUringState;
+
+//! IOUring submits a batch of reads to the kernel at once through a Linux io_uring, so that the reads can be executed
+//! concurrently by the storage device. io_uring is only available on Linux (5.1+), and can be disabled by the kernel
+//! or by a seccomp filter (e.g. in containers) - in that case TryCreate returns nullptr.
+class IOUring {
+public:
+	explicit IOUring(unique_ptr<IOUringState> state);
+	~IOUring();
+
+public:
+	//! Try to set up an io_uring with space for (at least) the given amount of entries
+	static unique_ptr<IOUring> TryCreate(idx_t entries);
+	//! Take an idle io_uring from the pool of the process, or set up a new one if there is none (or nullptr if io_uring
+	//! is not available). Setting up a ring costs several system calls, so rings are reused across batches.
+	static unique_ptr<IOUring> Acquire();
+	//! Return a ring that has no reads in flight to the pool, so it can be reused by the next batch
+	static void Release(unique_ptr<IOUring> ring);
+	//! Submit the reads of the given file descriptor and wait until all of them have completed. The result of every
+	//! read is stored in "results": either the number of bytes read, or a negative errno if the read failed.
+	void Read(int fd, FileReadRequest *requests, idx_t count, int64_t *results);
+
+public:
+	//! The amount of entries of the pooled rings, larger batches are submitted in multiple chunks
+	static constexpr const idx_t RING_ENTRIES = 128;
+	//! The maximum amount of idle rings that are kept in the pool
+	static constexpr const idx_t MAX_IDLE_RINGS = 32;
+
+private:
+	unique_ptr<IOUringState> state;
+};
+
+} // namespace duckdb
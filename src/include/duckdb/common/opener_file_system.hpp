@@ -38,6 +38,10 @@ public:
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
 
+	void ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) override {
+		GetFileSystem().ReadBatch(handle, requests, count);
+	}
+
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Read(handle, buffer, nr_bytes);
 	}
@@ -22,6 +22,12 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Number of bytes of a string that are stored in the radix sorting data if the string may be longer
+	static constexpr idx_t STRING_PREFIX_SIZE = 12;
+	//! Strings that are at most this long (according to statistics) are stored entirely in the radix sorting data
+	static constexpr idx_t MAX_NORMALIZED_STRING_SIZE = 32;
+	//! Maximum number of sorted blocks that are merged at once during an in-memory merge round
+	static constexpr idx_t MERGE_FAN_IN = 8;
 };
 
 struct SortLayout {
@@ -61,6 +67,8 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Returns how many sorted blocks can be merged at once during an in-memory merge round
+	idx_t GetMaximumMergeFanIn();
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -91,11 +99,15 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
+	//! Number of sorted blocks that are merged together in the current round
+	idx_t merge_fan_in;
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+	//! Progress within each of the sorted blocks of the current group (k-way merge path)
+	vector<idx_t> run_starts;
 };
 
 struct LocalSortState {
@@ -170,6 +182,12 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The readers and input blocks of a k-way merge
+	vector<unique_ptr<SBScanState>> runs;
+	vector<unique_ptr<SortedBlock>> run_inputs;
+	//! Winner tree used to compute a k-way merge
+	vector<idx_t> winner_tree;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -177,6 +195,25 @@ private:
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+	//! Compare values within SortedBlocks using a global index, without using the progress of the merge
+	int CompareEntries(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+
+	//! Computes the slices of the sorted blocks of the current group that will be merged next (k-way Merge Path)
+	void GetNextKWayPartition();
+	//! Finds the number of rows of each sorted block that are among the 'rank' smallest rows of the group
+	void GetKWaySplit(vector<unique_ptr<SBScanState>> &scans, const vector<idx_t> &counts, const idx_t rank,
+	                  vector<idx_t> &ends);
+	//! Merges the slices computed by GetNextKWayPartition
+	void MergeKWayPartition();
+	//! Computes from which run the next 'count' tuples should be taken by setting the 'sources' array
+	void ComputeKWayMerge(const idx_t &count, idx_t sources[]);
+	//! Whether the current row of run 'l' comes before the current row of run 'r'
+	bool KWayRunIsSmaller(const idx_t l, const idx_t r, const data_ptr_t run_ptrs[]);
+	//! Merges the radix sorting blocks according to the 'sources' array
+	void MergeKWayRadix(const idx_t &count, const idx_t sources[]);
+	//! Merges SortedData according to the 'sources' array
+	void MergeKWayData(SortedData &result_data, SortedDataType type, const idx_t &count, const idx_t sources[],
+	                   bool reset_indices);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
@@ -133,6 +133,8 @@ public:
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count);
 	//! Slice the vector, keeping the result around in a cache or potentially using the cache instead of slicing
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count, SelCache &cache);
+	//! Turns this vector into a dictionary vector over the first "dictionary_size" entries of "dict"
+	DUCKDB_API void Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count);
 
 	//! Creates the data of this vector with the specified type. Any data that
 	//! is currently in the vector is destroyed.
@@ -305,6 +307,22 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The amount of entries in the dictionary, only known if the vector was created through Vector::Dictionary
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	//! The identifier of the dictionary (if known)
+	static inline optional_idx DictionaryId(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionaryId();
+	}
+	static inline void SetDictionaryId(Vector &vector, idx_t new_id) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		vector.buffer->Cast<DictionaryBuffer>().SetDictionaryId(new_id);
+	}
+	//! Generates a new, process-wide unique, dictionary identifier
+	DUCKDB_API static idx_t GenerateDictionaryId();
 };
 
 struct FlatVector {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/string_type.hpp"
@@ -159,9 +160,25 @@ public:
 	void SetSelVector(const SelectionVector &vector) {
 		this->sel_vector.Initialize(vector);
 	}
+	void SetDictionarySize(idx_t dict_size) {
+		dictionary_size = dict_size;
+	}
+	optional_idx GetDictionarySize() const {
+		return dictionary_size;
+	}
+	void SetDictionaryId(optional_idx id) {
+		dictionary_id = id;
+	}
+	optional_idx GetDictionaryId() const {
+		return dictionary_id;
+	}
 
 private:
 	SelectionVector sel_vector;
+	//! The amount of entries in the dictionary (if known)
+	optional_idx dictionary_size;
+	//! A unique identifier of the dictionary - vectors with the same identifier share the same dictionary
+	optional_idx dictionary_id;
 };
 
 class VectorStringBuffer : public VectorBuffer {
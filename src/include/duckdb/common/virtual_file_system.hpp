@@ -24,6 +24,7 @@ public:
 
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void ReadBatch(FileHandle &handle, FileReadRequest *requests, idx_t count) override;
 
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
@@ -13,6 +13,7 @@
 #include "duckdb/function/function.hpp"
 
 namespace duckdb {
+class BoundFunctionExpression;
 class Expression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
@@ -57,10 +58,20 @@ struct ExecuteFunctionState : public ExpressionState {
 
 	unique_ptr<FunctionLocalState> local_state;
 
+	//! The identifier of the input dictionary the function was last executed on
+	optional_idx input_dictionary_id;
+	//! The result of executing the function on every entry of the input dictionary
+	unique_ptr<Vector> output_dictionary;
+	//! The identifier of the output dictionary
+	idx_t output_dictionary_id = 0;
+
 public:
 	static optional_ptr<FunctionLocalState> GetFunctionState(ExpressionState &state) {
 		return state.Cast<ExecuteFunctionState>().local_state.get();
 	}
+
+	//! Try to execute the function only once for every entry of a dictionary input, returns false if not possible
+	bool TryExecuteDictionaryExpression(const BoundFunctionExpression &expr, DataChunk &args, Vector &result);
 };
 
 struct ExpressionExecutorState {
@@ -125,8 +125,12 @@ public:
 	void Merge(JoinHashTable &other);
 	//! Combines the partitions in sink_collection into data_collection, as if it were not partitioned
 	void Unpartition();
-	//! Initialize the pointer table for the probe
+	//! Allocate and initialize the pointer table for the probe
 	void InitializePointerTable();
+	//! Allocate the pointer table for the probe, without initializing its entries
+	void AllocatePointerTable();
+	//! Initialize the entries [entry_idx_from, entry_idx_to) of the pointer table
+	void InitializePointerTable(idx_t entry_idx_from, idx_t entry_idx_to);
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
@@ -155,6 +159,19 @@ public:
 		return *data_collection;
 	}
 
+	//! The number of radix partitions in the data collection
+	idx_t PointerTablePartitionCount() const {
+		return partition_chunk_offsets.size() - 1;
+	}
+	//! Partition i holds the chunks [offsets[i], offsets[i + 1]) of the data collection
+	const vector<idx_t> &GetPartitionChunkOffsets() const {
+		return partition_chunk_offsets;
+	}
+	//! Partition i is inserted into the entries [offsets[i], offsets[i + 1]) of the pointer table
+	const vector<idx_t> &GetPartitionEntryOffsets() const {
+		return partition_entry_offsets;
+	}
+
 	//! BufferManager
 	BufferManager &buffer_manager;
 	//! The join conditions
@@ -188,8 +205,6 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
-	//! Bitmask for getting relevant bits from the hashes to determine the position
-	uint64_t bitmask;
 
 	struct {
 		mutex mj_lock;
@@ -213,13 +228,14 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Look up the heads of the row chains for the given hashes in the directory (nullptr if there are none)
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
 	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel);
+	//! Record the partitions that were combined into data_collection (with their row counts)
+	void SetPointerTablePartitions(idx_t partition_idx_from, idx_t partition_idx_to);
 
 	idx_t PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat> &vector_data, const SelectionVector *&current_sel,
 	                  SelectionVector &sel, bool build_side);
@@ -231,7 +247,20 @@ private:
 	//! The DataCollection holding the main data of the hash table
 	unique_ptr<TupleDataCollection> data_collection;
 	//! The hash map of the HT, created after finalization
+	//! This is a linear probing directory of salted entries that point to chains of rows with the same salt.
+	//! Every radix partition has its own region in the directory, sized to the row count of the partition, so that
+	//! partitions can be initialized and inserted into independently of each other
 	AllocatedData hash_map;
+	//! The radix partition of a hash is given by (hash & partition_mask) >> partition_shift
+	hash_t partition_mask;
+	idx_t partition_shift;
+	//! The first radix partition that is present in data_collection
+	idx_t partition_offset;
+	//! The row and chunk counts of the partitions in data_collection
+	vector<idx_t> partition_counts;
+	vector<idx_t> partition_chunk_offsets;
+	//! The regions of the partitions in the hash map
+	vector<idx_t> partition_entry_offsets;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 
@@ -306,9 +335,17 @@ public:
 	static idx_t PointerTableCapacity(idx_t count) {
 		return MaxValue<idx_t>(NextPowerOfTwo(count * 2), 1 << 10);
 	}
+	//! Capacity of the pointer table region of a single partition given its count
+	static idx_t PartitionPointerTableCapacity(idx_t count) {
+		return NextPowerOfTwo(MaxValue<idx_t>(count * 2, 1));
+	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(ht_entry_t);
+	}
+	//! Size of the pointer table region of a single partition (in bytes)
+	static idx_t PartitionPointerTableSize(idx_t count) {
+		return PartitionPointerTableCapacity(count) * sizeof(ht_entry_t);
 	}
 
 	//! Get total size of HT if all partitions would be built
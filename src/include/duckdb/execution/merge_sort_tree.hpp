@@ -9,12 +9,14 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/vector_operations/aggregate_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include <iomanip>
 
 namespace duckdb {
@@ -100,10 +102,16 @@ struct MergeSortTree {
 		CMP cmp;
 	};
 
-	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp) {
+	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp), build_next(0), build_done(0) {
 	}
 	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp = CMP());
 
+	//! Allocates the levels above the lowest level and splits their runs into units that can be built in parallel
+	void Allocate(Elements &&lowest_level);
+	//! Builds units until there are none left to claim, and then waits until all units are built.
+	//! Can be called by multiple threads after Allocate.
+	void Build();
+
 	idx_t SelectNth(const SubFrames &frames, idx_t n) const;
 
 	inline ElementType NthElement(idx_t i) const {
@@ -120,6 +128,19 @@ struct MergeSortTree {
 	static constexpr auto CASCADING = C;
 
 protected:
+	//! Builds the runs [run_begin, run_end) of a level by merging the runs of the level below
+	void BuildRuns(idx_t level_idx, idx_t run_begin, idx_t run_end);
+
+	//! The first build unit of each level, followed by the total number of units
+	vector<idx_t> build_units;
+	//! The next build unit to claim
+	atomic<idx_t> build_next;
+	//! The number of build units that are done
+	atomic<idx_t> build_done;
+
+	//! The minimum number of elements in a build unit
+	static constexpr idx_t BUILD_ELEMENTS = 32768;
+
 	RunElement StartGames(Games &losers, const RunElements &elements, const RunElement &sentinel) {
 		const auto elem_nodes = elements.size();
 		const auto game_nodes = losers.size();
@@ -250,92 +271,152 @@ protected:
 };
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
-MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp) {
+MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp)
+    : cmp(cmp), build_next(0), build_done(0) {
+	Allocate(std::move(lowest_level));
+	Build();
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Allocate(Elements &&lowest_level) {
 	const auto fanout = F;
 	const auto cascading = C;
 	const auto count = lowest_level.size();
 	tree.emplace_back(Level(std::move(lowest_level), Offsets()));
 
-	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
-
-	//	Fan in parent levels until we are at the top
+	//	Allocate the parent levels until we are at the top
 	//	Note that we don't build the top layer as that would just be all the data.
+	build_units.push_back(0);
 	for (idx_t child_run_length = 1; child_run_length < count;) {
 		const auto run_length = child_run_length * fanout;
 		const auto num_runs = (count + run_length - 1) / run_length;
 
-		Elements elements;
-		elements.reserve(count);
-
-		//	Allocate cascading pointers only if there is room
+		//	Allocate cascading pointers only if there is room.
+		//	Every run but the last is full, so the pointers of a run start at a fixed stride.
 		Offsets cascades;
 		if (cascading > 0 && run_length > cascading) {
-			const auto num_cascades = fanout * num_runs * (run_length / cascading + 2);
-			cascades.reserve(num_cascades);
+			const auto run_cascades = fanout * (run_length / cascading + 2);
+			const auto last_length = count - (num_runs - 1) * run_length;
+			const auto last_cascades = fanout * ((last_length + cascading - 1) / cascading + 2);
+			cascades.resize((num_runs - 1) * run_cascades + last_cascades);
 		}
+		tree.emplace_back(Elements(count), std::move(cascades));
 
-		//	Create each parent run by merging the child runs using a tournament tree
-		// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
-		//	TODO: Because the runs are independent, they can be parallelised with parallel_for
-		const auto &child_level = tree.back();
-		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
-			//	Position markers for scanning the children.
-			using Bounds = pair<idx_t, idx_t>;
-			array<Bounds, fanout> bounds;
-			//	Start with first element of each (sorted) child run
-			RunElements players;
-			const auto child_base = run_idx * run_length;
-			for (idx_t child_run = 0; child_run < fanout; ++child_run) {
-				const auto child_idx = child_base + child_run * child_run_length;
-				bounds[child_run] = {MinValue<idx_t>(child_idx, count),
-				                     MinValue<idx_t>(child_idx + child_run_length, count)};
-				if (bounds[child_run].first != bounds[child_run].second) {
-					players[child_run] = {child_level.first[child_idx], child_run};
-				} else {
-					//	Empty child
-					players[child_run] = SENTINEL;
-				}
+		//	The runs of a level are independent, so split them into units that can be built in parallel
+		const auto unit_runs = MaxValue<idx_t>(BUILD_ELEMENTS / run_length, 1);
+		build_units.push_back(build_units.back() + (num_runs + unit_runs - 1) / unit_runs);
+		child_run_length = run_length;
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Build() {
+	const auto fanout = F;
+	const auto count = tree.front().first.size();
+
+	const auto total_units = build_units.back();
+	idx_t level_idx = 1;
+	idx_t run_length = fanout;
+	for (auto unit_idx = build_next++; unit_idx < total_units; unit_idx = build_next++) {
+		//	Units are claimed in order, so the level below is being built by active threads
+		while (build_units[level_idx] <= unit_idx) {
+			++level_idx;
+			run_length *= fanout;
+		}
+		while (build_done < build_units[level_idx - 1]) {
+			TaskScheduler::YieldThread();
+		}
+
+		const auto num_runs = (count + run_length - 1) / run_length;
+		const auto unit_runs = MaxValue<idx_t>(BUILD_ELEMENTS / run_length, 1);
+		const auto run_begin = (unit_idx - build_units[level_idx - 1]) * unit_runs;
+		BuildRuns(level_idx, run_begin, MinValue(run_begin + unit_runs, num_runs));
+
+		++build_done;
+	}
+
+	//	Wait for the units claimed by other threads
+	while (build_done < total_units) {
+		TaskScheduler::YieldThread();
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::BuildRuns(idx_t level_idx, idx_t run_begin, idx_t run_end) {
+	const auto fanout = F;
+	const auto cascading = C;
+	const auto &child_level = tree[level_idx - 1];
+	auto &level = tree[level_idx];
+	auto &elements = level.first;
+	auto &cascades = level.second;
+	const auto count = elements.size();
+
+	idx_t child_run_length = 1;
+	for (idx_t i = 1; i < level_idx; ++i) {
+		child_run_length *= fanout;
+	}
+	const auto run_length = child_run_length * fanout;
+	const auto run_cascades = cascading > 0 ? fanout * (run_length / cascading + 2) : 0;
+
+	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
+
+	//	Create each parent run by merging the child runs using a tournament tree
+	// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
+	for (idx_t run_idx = run_begin; run_idx < run_end; ++run_idx) {
+		//	Position markers for scanning the children.
+		using Bounds = pair<idx_t, idx_t>;
+		array<Bounds, fanout> bounds;
+		//	Start with first element of each (sorted) child run
+		RunElements players;
+		const auto child_base = run_idx * run_length;
+		for (idx_t child_run = 0; child_run < fanout; ++child_run) {
+			const auto child_idx = child_base + child_run * child_run_length;
+			bounds[child_run] = {MinValue<idx_t>(child_idx, count),
+			                     MinValue<idx_t>(child_idx + child_run_length, count)};
+			if (bounds[child_run].first != bounds[child_run].second) {
+				players[child_run] = {child_level.first[child_idx], child_run};
+			} else {
+				//	Empty child
+				players[child_run] = SENTINEL;
 			}
+		}
 
-			//	Play the first round and extract the winner
-			Games games;
-			auto winner = StartGames(games, players, SENTINEL);
-			while (winner != SENTINEL) {
-				// Add fractional cascading pointers
-				// if we are on a fraction boundary
-				if (cascading > 0 && run_length > cascading && elements.size() % cascading == 0) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
+		//	Play the first round and extract the winner
+		auto element_idx = child_base;
+		auto cascade_idx = run_idx * run_cascades;
+		Games games;
+		auto winner = StartGames(games, players, SENTINEL);
+		while (winner != SENTINEL) {
+			// Add fractional cascading pointers
+			// if we are on a fraction boundary
+			if (cascading > 0 && run_length > cascading && element_idx % cascading == 0) {
+				for (idx_t i = 0; i < fanout; ++i) {
+					cascades[cascade_idx++] = OffsetType(bounds[i].first);
 				}
+			}
 
-				//	Insert new winner element into the current run
-				elements.emplace_back(winner.first);
-				const auto child_run = winner.second;
-				auto &child_idx = bounds[child_run].first;
-				++child_idx;
-
-				//	Move to the next entry in the child run (if any)
-				if (child_idx < bounds[child_run].second) {
-					winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
-				} else {
-					winner = ReplayGames(games, child_run, SENTINEL);
-				}
+			//	Insert new winner element into the current run
+			elements[element_idx++] = winner.first;
+			const auto child_run = winner.second;
+			auto &child_idx = bounds[child_run].first;
+			++child_idx;
+
+			//	Move to the next entry in the child run (if any)
+			if (child_idx < bounds[child_run].second) {
+				winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
+			} else {
+				winner = ReplayGames(games, child_run, SENTINEL);
 			}
+		}
 
-			// Add terminal cascade pointers to the end
-			if (cascading > 0 && run_length > cascading) {
-				for (idx_t j = 0; j < 2; ++j) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
+		// Add terminal cascade pointers to the end
+		if (cascading > 0 && run_length > cascading) {
+			for (idx_t j = 0; j < 2; ++j) {
+				for (idx_t i = 0; i < fanout; ++i) {
+					cascades[cascade_idx++] = OffsetType(bounds[i].first);
 				}
 			}
 		}
-
-		//	Insert completed level and move up to the next one
-		tree.emplace_back(std::move(elements), std::move(cascades));
-		child_run_length = run_length;
 	}
 }
 
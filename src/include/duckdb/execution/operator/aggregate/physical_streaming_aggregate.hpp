@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by and aggregation on input in which equal groups are adjacent,
+//! emitting every group as soon as the group keys change
+//! It keeps the current group across chunks, so it is not a parallel operator: its pipeline runs on a single thread
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+	//! The group types
+	vector<LogicalType> group_types;
+	//! The payload types
+	vector<LogicalType> payload_types;
+	//! The aggregates to be computed
+	vector<AggregateObject> aggregate_objects;
+
+	unordered_map<Expression *, size_t> filter_indexes;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -8,12 +8,29 @@
 
 #pragma once
 
+#include "duckdb/common/types/value.hpp"
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
 
 class PhysicalHashAggregate;
 
+//! A column of a table scan in the delim side whose rows can only find a match if their value occurs in a column of
+//! the duplicate eliminated side. The values of that column are pushed into the scan once the delim join is finished.
+struct DelimJoinFilterTarget {
+	//! The table scan and its runtime filters
+	const_reference<PhysicalOperator> scan;
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The index of the filtered column in the column_ids of the table scan
+	idx_t scan_column_index;
+	//! The column of the duplicate eliminated side that holds the values
+	idx_t sink_column_index;
+	//! Whether the join condition matches NULL values (i.e., IS NOT DISTINCT FROM)
+	bool null_values_are_equal;
+};
+
 //! PhysicalDelimJoin represents a join where either the LHS or RHS will be duplicate eliminated and pushed into a
 //! PhysicalColumnDataScan in the other side. Implementations are PhysicalLeftDelimJoin and PhysicalRightDelimJoin
 class PhysicalDelimJoin : public PhysicalOperator {
@@ -24,6 +41,8 @@ public:
 	unique_ptr<PhysicalOperator> join;
 	unique_ptr<PhysicalHashAggregate> distinct;
 	vector<const_reference<PhysicalOperator>> delim_scans;
+	//! The table scans in the delim side that are filtered with the values of the duplicate eliminated side
+	vector<DelimJoinFilterTarget> filter_targets;
 
 public:
 	vector<const_reference<PhysicalOperator>> GetChildren() const override;
@@ -44,4 +63,44 @@ public:
 	string ParamsToString() const override;
 };
 
+//! The values of a column of the duplicate eliminated side that filter one or more table scans
+struct DelimJoinFilterColumn {
+	DelimJoinFilterColumn(idx_t sink_column_index, const LogicalType &type);
+
+	idx_t sink_column_index;
+	LogicalType type;
+	//! The min/max of the column (numeric columns only)
+	BaseStatistics stats;
+	bool has_null;
+	//! Whether the distinct values are (still) collected - they are discarded if there are too many
+	bool collect_values;
+	vector<Value> values;
+	//! Maps the hash of the collected values to the index of the last value with that hash in "values"
+	unordered_map<hash_t, idx_t> value_map;
+	//! For each value, the index of the previous value with the same hash (or DConstants::INVALID_INDEX)
+	vector<idx_t> value_chain;
+};
+
+//! Collects the values of the duplicate eliminated side of a delim join and pushes them into the filter targets
+class DelimJoinFilterState {
+public:
+	//! Up to this many distinct values are pushed as an IN filter, otherwise only the min/max is pushed
+	static constexpr const idx_t MAX_IN_FILTER_VALUES = 1024;
+
+public:
+	explicit DelimJoinFilterState(const PhysicalDelimJoin &op);
+
+	void Sink(DataChunk &chunk);
+	void Combine(DelimJoinFilterState &other);
+	//! Pushes the collected values into the table scans of the filter targets
+	void PushFilters(const PhysicalDelimJoin &op);
+
+private:
+	vector<DelimJoinFilterColumn> columns;
+	//! The index of the column for each of the filter targets
+	vector<idx_t> target_columns;
+	//! Hashes of the current chunk
+	Vector hashes;
+};
+
 } // namespace duckdb
@@ -14,9 +14,25 @@
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/operator/logical_join.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
+struct JoinFilterPushdownColumn {
+	//! The index of the join condition the filter is derived from
+	idx_t join_condition;
+	//! The index of the filtered column in the column_ids of the probe-side table scan
+	idx_t probe_column_index;
+};
+
+//! Runtime filters that are pushed from the finished build side into a table scan on the probe side
+struct JoinFilterPushdownInfo {
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The join keys for which the min/max of the build side is pushed
+	vector<JoinFilterPushdownColumn> columns;
+};
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
@@ -33,6 +49,10 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Whether or not the build-side key range of the given type can be pushed into the probe side as a filter
+	static bool CanPushJoinFilter(const LogicalType &type);
+	//! Updates the min/max statistics with the (non-NULL) keys, the keys must have a type that CanPushJoinFilter
+	static void UpdateKeyStatistics(BaseStatistics &stats, Vector &keys, idx_t count);
 
 	//! The types of the join keys
 	vector<LogicalType> condition_types;
@@ -51,6 +71,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Runtime filters pushed into the probe side (if any)
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
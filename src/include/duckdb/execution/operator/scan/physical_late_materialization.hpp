@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/scan/physical_late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! PhysicalLateMaterialization fetches the columns of a base table for a (small) set of row ids. It is placed on top
+//! of a Top-N that was computed over only the sort keys and the row ids of a table scan, so that the remaining
+//! columns are only read for the rows that survive the Top-N.
+class PhysicalLateMaterialization : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::LATE_MATERIALIZATION;
+
+public:
+	PhysicalLateMaterialization(vector<LogicalType> types, DuckTableEntry &table, vector<column_t> column_ids,
+	                            vector<string> names, idx_t row_id_index, idx_t estimated_cardinality);
+
+	//! The table to fetch the rows from
+	DuckTableEntry &table;
+	//! The (storage) column ids to fetch, COLUMN_IDENTIFIER_ROW_ID fetches the row id itself
+	vector<column_t> column_ids;
+	//! The names of the fetched columns
+	vector<string> names;
+	//! The index of the row id column in the input chunk
+	idx_t row_id_index;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
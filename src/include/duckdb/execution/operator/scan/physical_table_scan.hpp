@@ -42,6 +42,8 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! Filters that are pushed into the scan at runtime, e.g., by the build side of a hash join (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
 
@@ -71,6 +73,12 @@ public:
 	}
 
 	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+
+private:
+	string FiltersToString(const TableFilterSet &filters) const;
 };
 
 } // namespace duckdb
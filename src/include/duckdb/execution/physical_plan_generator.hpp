@@ -20,6 +20,7 @@
 namespace duckdb {
 class ClientContext;
 class ColumnDataCollection;
+class PhysicalTableScan;
 
 //! The physical plan generator generates a physical execution plan from a
 //! logical query plan
@@ -46,6 +47,9 @@ public:
 	static bool PreserveInsertionOrder(ClientContext &context, PhysicalOperator &plan);
 
 	static bool HasEquality(vector<JoinCondition> &conds, idx_t &range_count);
+	//! Follows a column of the probe side of a join down to the table scan that produces it (if any), and sets
+	//! column_index to the index of the column in the column_ids of the scan
+	static optional_ptr<PhysicalTableScan> FindProbeTableScan(PhysicalOperator &op, idx_t &column_index);
 
 protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalOperator &op);
@@ -97,6 +101,7 @@ protected:
 	unique_ptr<PhysicalOperator> PlanAsOfJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanComparisonJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanDelimJoin(LogicalComparisonJoin &op);
+	unique_ptr<PhysicalOperator> PlanLateMaterialization(LogicalTopN &op);
 	unique_ptr<PhysicalOperator> ExtractAggregateExpressions(unique_ptr<PhysicalOperator> child,
 	                                                         vector<unique_ptr<Expression>> &expressions,
 	                                                         vector<unique_ptr<Expression>> &groups);
@@ -143,6 +143,11 @@ public:
 	virtual ~WindowExecutor() {
 	}
 
+	//! Does Sink need to see the partition data?
+	virtual bool RequiresSink() const {
+		return range.input_expr.expr;
+	}
+
 	virtual void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
 		range.Append(input_chunk);
 	}
@@ -150,6 +155,10 @@ public:
 	virtual void Finalize() {
 	}
 
+	//! Share the work of a Finalize that is running on another thread
+	virtual void AssistFinalize() {
+	}
+
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorState &lstate) const;
@@ -183,8 +192,12 @@ public:
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
 	                        WindowAggregationMode mode);
 
+	bool RequiresSink() const override {
+		return true;
+	}
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	void AssistFinalize() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -258,6 +271,9 @@ public:
 	WindowValueExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                    const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
+	bool RequiresSink() const override {
+		return true;
+	}
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -56,6 +58,9 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Share the work of a Finalize that is running on another thread
+	virtual void AssistFinalize() {
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -140,6 +145,7 @@ public:
 	~WindowCustomAggregator() override;
 
 	void Finalize(const FrameStats &stats) override;
+	void AssistFinalize() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -150,6 +156,8 @@ public:
 
 	//! Data pointer that contains a single state, used for global custom window state
 	unique_ptr<WindowAggregatorState> gstate;
+	//! Whether window_init is done, so other threads can help with window_build
+	atomic<bool> build_ready;
 };
 
 class WindowSegmentTree : public WindowAggregator {
@@ -160,6 +168,7 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	void AssistFinalize() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -167,6 +176,8 @@ public:
 
 public:
 	void ConstructTree();
+	//! Build units of tree nodes until there are none left to claim
+	void BuildTree(WindowAggregatorState &lstate);
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -184,8 +195,23 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! For each level, the index of its first build unit (the last entry is the total)
+	vector<idx_t> build_units;
+	//! Whether the tree layout is ready for other threads to help building it
+	atomic<bool> build_ready;
+	//! The next build unit to claim
+	atomic<idx_t> build_next;
+	//! The number of completed build units
+	atomic<idx_t> build_done;
+	//! The states of the helping threads, which own the memory of the nodes they built
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+	//! Serialise access to build_states
+	mutex build_lock;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of tree nodes in a build unit
+	static constexpr idx_t BUILD_NODES = 2048;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
@@ -75,6 +75,10 @@ typedef void (*aggregate_window_t)(AggregateInputData &aggr_input_data, const Wi
 typedef void (*aggregate_wininit_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
                                     data_ptr_t g_state);
 
+//! The type used for building the shared custom windowed aggregate state in parallel (optional)
+typedef void (*aggregate_winbuild_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+                                     data_ptr_t g_state);
+
 typedef void (*aggregate_serialize_t)(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
                                       const AggregateFunction &function);
 typedef unique_ptr<FunctionData> (*aggregate_deserialize_t)(Deserializer &deserializer, AggregateFunction &function);
@@ -149,6 +153,9 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The windowed aggregate custom parallel build function, called after window_init by the finalizing thread and
+	//! by any threads waiting for the partition. It must return once the shared state is complete (may be null)
+	aggregate_winbuild_t window_build = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -22,6 +22,8 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class SelectionVector;
+class TableFilter;
 struct ColumnSegmentState;
 
 struct ColumnFetchState;
@@ -142,6 +144,12 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector (STANDARD_VECTOR_SIZE) while applying a filter directly to
+//! the compressed data. On entry 'sel' holds the 'sel_count' rows that are still alive, on exit it holds the rows
+//! that pass the filter. Only the rows that pass the filter need to be written to the result vector.
+//! The filter never contains IS NULL/IS NOT NULL: NULL values are handled by the caller through the validity mask.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -184,7 +192,7 @@ public:
 	      init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial), fetch_row(fetch_row), skip(skip),
 	      init_segment(init_segment), init_append(init_append), append(append), finalize_append(finalize_append),
 	      revert_append(revert_append), serialize_state(serialize_state), deserialize_state(deserialize_state),
-	      cleanup_state(cleanup_state) {
+	      cleanup_state(cleanup_state), filter(nullptr) {
 	}
 
 	//! Compression type
@@ -250,6 +258,13 @@ public:
 	compression_deserialize_state_t deserialize_state;
 	//! Cleanup the segment state (optional)
 	compression_cleanup_state_t cleanup_state;
+
+	// Filter functions
+	//! This is only necessary if the filter can be evaluated more efficiently on the compressed data than on the
+	//! decompressed vector
+
+	//! Scan an entire vector while applying a table filter on the compressed data (optional)
+	compression_filter_t filter;
 };
 
 //! The set of compression functions
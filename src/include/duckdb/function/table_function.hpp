@@ -26,6 +26,13 @@ class LogicalGet;
 class TableFilterSet;
 class TableCatalogEntry;
 
+enum class TableFunctionInitialization : uint8_t {
+	//! The global state is initialized lazily by whichever thread first executes the scan
+	INITIALIZE_ON_EXECUTE = 0,
+	//! The global state must be initialized eagerly by the main thread when the query is scheduled
+	INITIALIZE_ON_SCHEDULE = 1
+};
+
 struct TableFunctionInfo {
 	DUCKDB_API virtual ~TableFunctionInfo();
 
@@ -281,6 +288,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the global state may be initialized on any thread. Functions that call back into clients that
+	//! are not thread-safe (e.g., R) need to be initialized on schedule, and cannot receive runtime filters
+	TableFunctionInitialization global_initialization;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
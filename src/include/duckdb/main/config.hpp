@@ -12,6 +12,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -98,8 +99,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
-	//! Whether or not to use Direct IO, bypassing operating system buffers
+	//! Whether or not automatic checkpoints are performed by a background thread instead of the committing transaction
+	bool enable_background_checkpoint = false;
+	//! Whether or not to use Direct IO for database and temporary files, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! Whether or not to submit batched reads of database files through io_uring (Linux only)
+	bool enable_io_uring = false;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 #ifdef DUCKDB_EXTENSION_AUTOLOAD_DEFAULT
@@ -120,8 +125,14 @@ struct DBConfigOptions {
 	string autoinstall_extension_repo = "";
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
+	//! The policy that decides which blocks are evicted from the buffer pool first
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	//! Whether or not buffer-managed blocks are allocated from huge pages that are bound to NUMA nodes
+	bool enable_huge_page_allocation = false;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
+	//! Whether or not blocks that are written to the temporary directory are compressed (with LZ4)
+	bool enable_temp_file_compression = false;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = DConstants::INVALID_INDEX;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -181,6 +192,8 @@ struct DBConfigOptions {
 	bool allow_extensions_metadata_mismatch = false;
 	//! Enable emitting FSST Vectors
 	bool enable_fsst_vectors = false;
+	//! Whether or not bloom filters are built for the columns of a row group when it is checkpointed
+	bool enable_checkpoint_bloom_filters = false;
 	//! Start transactions immediately in all attached databases - instead of lazily when a database is referenced
 	bool immediate_transaction_mode = false;
 	//! Debug setting - how to initialize  blocks in the storage layer when allocating
@@ -110,6 +110,9 @@ public:
 	DUCKDB_API void EndPhase();
 
 	DUCKDB_API void Initialize(const PhysicalOperator &root);
+	//! Renders the parameters of the profiled operators again, as they can change during execution (e.g., the filters
+	//! that are pushed into table scans at runtime). The operators must still be alive.
+	DUCKDB_API void UpdateExtraInfo();
 
 	DUCKDB_API string QueryTreeToString() const;
 	DUCKDB_API void QueryTreeToStream(std::ostream &str) const;
@@ -62,6 +62,16 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to decide which blocks are evicted from the buffer pool first (LRU or 2Q, LRU by default)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -216,6 +226,59 @@ struct EnableFSSTVectors {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableCheckpointBloomFilters {
+	static constexpr const char *Name = "enable_checkpoint_bloom_filters";
+	static constexpr const char *Description =
+	    "Build per row group bloom filters for columns when checkpointing, to skip row groups in equality lookups";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableBackgroundCheckpointSetting {
+	static constexpr const char *Name = "enable_background_checkpoint";
+	static constexpr const char *Description =
+	    "Perform automatic checkpoints in a background thread instead of in the committing transaction. Other "
+	    "transactions can read the database while the background checkpoint runs, writes wait for it to finish.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableHugePageAllocationSetting {
+	static constexpr const char *Name = "enable_huge_page_allocation";
+	static constexpr const char *Description =
+	    "Allocate buffer-managed blocks from huge pages that are bound to the NUMA node of the thread that first loads "
+	    "them (Linux only)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableIOUringSetting {
+	static constexpr const char *Name = "enable_io_uring";
+	static constexpr const char *Description =
+	    "Submit batched reads of database files through io_uring (Linux only). Applies to database files that are "
+	    "opened after the setting is changed";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableTempFileCompression {
+	static constexpr const char *Name = "enable_temp_file_compression";
+	static constexpr const char *Description =
+	    "Compress the blocks that are written to the temporary directory with LZ4 when this reduces their size";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowUnsignedExtensionsSetting {
 	static constexpr const char *Name = "allow_unsigned_extensions";
 	static constexpr const char *Description = "Allow to load extensions with invalid or missing signatures";
@@ -330,6 +393,16 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableTableScanPrefetchSetting {
+	static constexpr const char *Name = "enable_table_scan_prefetch";
+	static constexpr const char *Description =
+	    "Whether or not table scans read ahead the blocks of the next row group with batched reads";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ErrorsAsJsonSetting {
 	static constexpr const char *Name = "errors_as_json";
 	static constexpr const char *Description = "Output error messages as structured JSON instead of as a raw string";
@@ -634,6 +707,17 @@ struct ThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct UseDirectIOSetting {
+	static constexpr const char *Name = "use_direct_io";
+	static constexpr const char *Description =
+	    "Open database files and temporary files with direct I/O, bypassing the page cache of the operating system. "
+	    "Applies to files that are opened after the setting is changed";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct UsernameSetting {
 	static constexpr const char *Name = "username";
 	static constexpr const char *Description = "The username to use. Ignored for legacy compatibility.";
@@ -73,6 +73,9 @@ public:
 
 	//! Yield to other threads
 	static void YieldThread();
+	//! Returns the id of the CPU that the calling thread is (likely) running on, if this is not available, an id
+	//! derived from the calling thread is returned instead
+	static idx_t GetEstimatedCPUId();
 
 	//! Set the allocator flush threshold
 	void SetAllocatorFlushTreshold(idx_t threshold);
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class SelectionVector;
+struct UnifiedVectorFormat;
+struct InFilterSet;
+
+//! Set membership filter (i.e. column IN (C1, C2, ...)) that is evaluated by probing a hash set of the constants
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+	//! The maximum amount of values for which the zonemap is checked against every individual value
+	static constexpr const idx_t MAX_INDIVIDUAL_ZONEMAP_CHECKS = 64;
+
+public:
+	explicit InFilter(vector<Value> values);
+	~InFilter() override;
+
+	//! The (non-NULL) constant values to filter on, all of the same type
+	vector<Value> values;
+
+public:
+	//! Applies the filter to the rows in "sel" of the given vector - NULL values never pass the filter
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+	//! Whether or not an InFilter can be created for values of the given type
+	static bool SupportsType(const LogicalType &type);
+
+private:
+	//! The smallest and largest value in the set
+	Value min_value;
+	Value max_value;
+	//! The hash set used to evaluate the filter
+	unique_ptr<InFilterSet> set;
+};
+
+} // namespace duckdb
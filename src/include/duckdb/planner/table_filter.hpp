@@ -11,10 +11,13 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +25,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	IN_FILTER = 6 // set membership (e.g. IN (C1, C2, ...))
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -39,6 +43,7 @@ public:
 	//! Returns true if the statistics indicate that the segment can contain values that satisfy that filter
 	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) = 0;
 	virtual string ToString(const string &column_name) = 0;
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
@@ -100,4 +105,23 @@ public:
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet holds filters that are only known at execution time, e.g., the key range of the finished
+//! build side of a hash join. Filters are registered per operator, so that re-executing an operator replaces (rather
+//! than accumulates) its filters.
+class DynamicTableFilterSet {
+public:
+	//! Replaces all filters previously pushed by the operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Push a filter on the given column index of the table scan on behalf of an operator
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+
+	bool HasFilters() const;
+	//! Combines the static table filters of the scan (if any) with the dynamic filters into a new filter set
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
@@ -51,6 +51,8 @@ public:
 	virtual idx_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Read the content of the given blocks from disk as a single batch of reads, with one read per block
+	virtual void ReadBlocks(const vector<reference<Block>> &blocks) = 0;
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
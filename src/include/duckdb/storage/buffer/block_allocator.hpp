@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_allocator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/storage/storage_info.hpp"
+
+namespace duckdb {
+class DatabaseInstance;
+
+//! The BlockAllocator allocates the memory of the blocks that are managed by the buffer pool.
+//! When huge page allocation is enabled, blocks are carved out of a virtual memory arena that is backed by transparent
+//! huge pages, reducing the TLB misses when accessing them. The arena is divided into chunks of one huge page. Each
+//! chunk is bound to the NUMA node of the thread that allocates (i.e., first loads or pins) a block from it, and freed
+//! blocks are reused by threads on the same NUMA node.
+//! Allocations of other sizes, and all allocations when huge page allocation is disabled (or not supported by the
+//! platform), are aligned to the sector size if aligned allocation is enabled, so that the blocks can be read and
+//! written with direct I/O. Otherwise they are forwarded to the allocator of the database.
+class BlockAllocator {
+public:
+	BlockAllocator();
+	~BlockAllocator();
+
+	//! The size of a huge page, which is the granularity at which the arena is bound to NUMA nodes
+	static constexpr const idx_t CHUNK_SIZE = 2ULL * 1024ULL * 1024ULL;
+	static constexpr const idx_t BLOCKS_PER_CHUNK = CHUNK_SIZE / Storage::BLOCK_ALLOC_SIZE;
+	//! The maximum amount of NUMA nodes that have their own free blocks
+	static constexpr const idx_t MAX_NUMA_NODES = 64;
+	//! Chunks of which all blocks are free are only returned to the OS when a NUMA node holds more free blocks
+	static constexpr const idx_t FREE_BLOCK_CACHE_SIZE = 256;
+	//! The amount of partitions of the set of aligned pointers, each with their own lock
+	static constexpr const idx_t ALIGNED_POINTER_PARTITIONS = 64;
+
+public:
+	//! Returns the allocator that should be used for the blocks of the database
+	static Allocator &Get(DatabaseInstance &db);
+
+	//! Enable or disable the allocation of blocks from the huge page arena. Ignored on platforms other than Linux.
+	void SetHugePageAllocation(bool enable);
+	//! Set the allocator of the database, which allocates the memory that is not allocated from the arena or aligned
+	void SetDatabaseAllocator(Allocator &database_allocator_p);
+	//! Enable or disable allocating all blocks of the database through the block allocator, which aligns them to the
+	//! sector size as is required for direct I/O
+	void SetAlignedAllocation(bool enable);
+	bool IsEnabled() const {
+		return enabled || aligned_allocation;
+	}
+	Allocator &GetAllocator() {
+		return allocator;
+	}
+
+private:
+	struct ArenaChunk {
+		//! The NUMA node that the chunk is bound to
+		idx_t numa_node;
+		//! The amount of blocks of the chunk that are in use
+		idx_t used_blocks;
+	};
+	struct NUMANodeBlocks {
+		mutex lock;
+		//! The free blocks of the chunks that are bound to the NUMA node
+		vector<data_ptr_t> free_blocks;
+	};
+	struct AlignedPointers {
+		mutex lock;
+		unordered_set<data_ptr_t> pointers;
+	};
+
+	data_ptr_t AllocateData(idx_t size);
+	void FreeData(data_ptr_t pointer, idx_t size);
+	data_ptr_t ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t new_size);
+	Allocator &GetDatabaseAllocator();
+	//! Allocate or free memory outside of the arena, aligned to the sector size if aligned allocation is enabled
+	data_ptr_t AllocateNonArenaData(idx_t size);
+	void FreeNonArenaData(data_ptr_t pointer, idx_t size);
+	//! Whether or not the pointer was allocated aligned to the sector size, optionally forgetting the pointer
+	bool IsAlignedPointer(data_ptr_t pointer, bool erase);
+	//! The partition of the set of aligned pointers that the pointer belongs to
+	AlignedPointers &GetAlignedPointers(data_ptr_t pointer);
+
+	//! Reserve the virtual memory of the arena, returns false if this failed
+	bool ReserveArena();
+	//! Take a new chunk from the arena and add its blocks to the free blocks of the NUMA node
+	bool AllocateChunk(idx_t numa_node);
+	bool IsArenaPointer(data_ptr_t pointer) const;
+
+	static data_ptr_t BlockAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size);
+	static void BlockAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size);
+	static data_ptr_t BlockAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+	                                        idx_t size);
+
+private:
+	//! The allocator that is handed out to allocate blocks
+	Allocator allocator;
+	//! The allocator of the database, for the memory that is not allocated from the arena or aligned
+	optional_ptr<Allocator> database_allocator;
+	//! Whether or not new blocks are allocated from the arena
+	atomic<bool> enabled;
+	//! Whether or not the blocks of the database are allocated through the block allocator to align them
+	atomic<bool> aligned_allocation;
+	//! The amount of pointers that are currently allocated aligned to the sector size (outside of the arena) - while
+	//! there are none, frees do not have to look up the pointer
+	atomic<idx_t> aligned_pointer_count;
+	//! The pointers that were allocated aligned to the sector size, partitioned by their address so that frees of
+	//! different buffers do not contend on a single lock
+	unique_array<AlignedPointers> aligned_pointers;
+	//! The lock for reserving the arena
+	mutex arena_lock;
+	//! The mapping that holds the arena, and the (huge page aligned) arena itself
+	void *mapping;
+	idx_t mapping_size;
+	data_ptr_t arena;
+	idx_t arena_size;
+	//! The chunks of the arena, and the next chunk that has not been handed out
+	unique_array<ArenaChunk> chunks;
+	idx_t chunk_count;
+	atomic<idx_t> next_chunk;
+	//! The free blocks per NUMA node
+	unique_array<NUMANodeBlocks> numa_nodes;
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/common/enums/memory_tag.hpp"
 
 namespace duckdb {
+class Block;
 class BlockManager;
 class BufferHandle;
 class BufferPool;
@@ -106,6 +107,10 @@ public:
 
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
+	//! Allocate the buffer that a persistent block is read into, re-using the given buffer if possible
+	static unique_ptr<Block> AllocateLoadBuffer(BlockHandle &handle, unique_ptr<FileBuffer> reusable_buffer);
+	//! Load a persistent block from a buffer that its on-disk contents were read into
+	static BufferHandle LoadFromBlock(shared_ptr<BlockHandle> &handle, unique_ptr<Block> block);
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
 	void Unload();
 	bool CanUnload();
@@ -124,6 +129,10 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! The eviction queue that holds the latest node of this block, or INVALID_INDEX if there is none
+	idx_t eviction_queue_idx;
+	//! The time at which this block was last evicted from a probationary eviction queue (0 if never)
+	idx_t probation_eviction_time;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 
 namespace duckdb {
@@ -20,13 +23,15 @@ struct EvictionQueue;
 struct BufferEvictionNode {
 	BufferEvictionNode() {
 	}
-	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p)
-	    : handle(std::move(handle_p)), timestamp(timestamp_p) {
+	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p, idx_t insertion_time_p = 0)
+	    : handle(std::move(handle_p)), timestamp(timestamp_p), insertion_time(insertion_time_p) {
 		D_ASSERT(!handle.expired());
 	}
 
 	weak_ptr<BlockHandle> handle;
 	idx_t timestamp;
+	//! The time at which the node was added to a 2Q queue, used to compare the age of nodes of different queues
+	idx_t insertion_time;
 
 	bool CanUnload(BlockHandle &handle_p);
 	shared_ptr<BlockHandle> TryGetBlockHandle();
@@ -34,6 +39,13 @@ struct BufferEvictionNode {
 
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Depending on the eviction policy, unpinned blocks are either added to a single LRU queue, or to a probationary or
+//! protected queue of their memory tag (2Q). Blocks are first evicted from the LRU queue, then from the probationary
+//! queues, and only then from the protected queues - unless the protected blocks exceed their share of the memory
+//! limit, in which case the protected queues are evicted from first. Within the probationary and the protected queues
+//! the oldest block of all memory tags is evicted.
+//! To reduce contention between many threads, the eviction queues and the memory usage counters are sharded per group
+//! of cores.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -50,7 +62,10 @@ public:
 
 	void UpdateUsedMemory(MemoryTag tag, int64_t size);
 
+	//! Returns the used memory (including the memory usage that is still batched in the caches of the core groups)
 	idx_t GetUsedMemory() const;
+	//! Returns the used memory of a memory tag
+	idx_t GetUsedMemory(MemoryTag tag) const;
 
 	idx_t GetMaxMemory() const;
 
@@ -58,6 +73,49 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy that decides to which eviction queue unpinned blocks are added
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! The allocator of the blocks that are managed by the buffer pool
+	BlockAllocator &GetBlockAllocator();
+
+public:
+	//! The memory usage of the buffer pool, in total and per memory tag. Small updates are batched in a cache per core
+	//! group before they are applied to the shared counters, so threads do not contend on the shared counters.
+	struct MemoryUsage {
+		//! The maximum number of core groups that get their own cache
+		static constexpr idx_t MAX_CACHE_COUNT = 16;
+		//! Updates of at least this size (and cached values that reach it) are applied to the shared counters
+		static constexpr int64_t CACHE_THRESHOLD = 32768;
+		//! The index of the total memory usage in the counters, the other indexes are memory tags
+		static constexpr idx_t TOTAL_MEMORY_USAGE_INDEX = MEMORY_TAG_COUNT;
+		static constexpr idx_t COUNTER_COUNT = MEMORY_TAG_COUNT + 1;
+
+		struct Counters {
+			array<atomic<int64_t>, COUNTER_COUNT> counters;
+			//! Pads the counters of different core groups to separate cache lines
+			int64_t padding[16 - COUNTER_COUNT % 16];
+		};
+
+		explicit MemoryUsage(idx_t cache_count);
+
+		//! Returns the used memory at the index, optionally including the memory usage in the caches
+		idx_t GetUsedMemory(idx_t index, bool include_caches) const;
+		void UpdateUsedMemory(MemoryTag tag, int64_t size);
+
+	private:
+		void UpdateUsedMemory(Counters &cache, idx_t index, int64_t size);
+
+	private:
+		//! The shared counters
+		Counters memory_usage;
+		//! The number of core groups with a cache (1 means that all updates go to the shared counters)
+		idx_t cache_count;
+		//! The caches of the core groups
+		array<Counters, MAX_CACHE_COUNT> caches;
+	};
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -72,61 +130,43 @@ protected:
 	virtual EvictionResult EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 
-	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
+	//! Garbage collect dead nodes in the eviction queues.
 	void PurgeQueue();
-	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
+	//! Add a buffer handle to an eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
-	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
-	}
+	//! Increment the dead node counter of the eviction queue that holds the latest node of the handle.
+	void IncrementDeadNodes(BlockHandle &handle);
+
+private:
+	//! Returns the index of the eviction queue that the handle is added to when it is unpinned
+	idx_t GetEvictionQueueIndex(BlockHandle &handle) const;
+	//! Whether or not the eviction queue at this index is a probationary queue
+	static bool IsProbationQueue(idx_t queue_idx);
+	//! Returns the probationary or protected queue whose oldest node is the oldest, or INVALID_INDEX if all are empty
+	idx_t GetOldestEvictionQueue(bool probation);
+	//! Returns the approximate number of blocks in the protected queues
+	idx_t GetProtectedBlockCount() const;
 
 protected:
 	//! The lock for changing the memory limit
 	mutex limit_lock;
-	//! The current amount of memory that is occupied by the buffer manager (in bytes)
-	atomic<idx_t> current_memory;
+	//! The current amount of memory that is occupied by the buffer manager (in bytes), in total and per tag
+	MemoryUsage memory_usage;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! The eviction queues: the LRU queue, followed by the probationary and protected queue of every memory tag
+	vector<unique_ptr<EvictionQueue>> queues;
+	//! The policy that decides to which queue unpinned blocks are added
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! The number of blocks that were evicted from a probationary queue, used as the clock for re-loaded blocks
+	atomic<idx_t> probation_evictions;
+	//! The number of nodes that were added to the 2Q queues, used as the clock for the age of the nodes
+	atomic<idx_t> queue_insertions;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
-	//! Memory usage per tag
-	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
-
-	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
-	constexpr static idx_t INSERT_INTERVAL = 4096;
-	//! We multiply the base purge size by this value.
-	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
-	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
-	//! We never purge below this point.
-	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
-	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
-	//! exceed their allowed ratio. Must be greater than 1.
-	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
-
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
-	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
-	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
-	//! Only lets a single thread enter the purge phase.
-	mutex purge_lock;
-
-	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
-	vector<BufferEvictionNode> purge_nodes;
+	//! Allocates the memory of the blocks
+	unique_ptr<BlockAllocator> block_allocator;
 };
 
 } // namespace duckdb
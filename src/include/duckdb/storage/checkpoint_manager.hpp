@@ -25,13 +25,17 @@ class TypeCatalogEntry;
 
 class CheckpointWriter {
 public:
-	explicit CheckpointWriter(AttachedDatabase &db) : db(db) {
+	explicit CheckpointWriter(AttachedDatabase &db, bool concurrent_reads = false)
+	    : db(db), concurrent_reads(concurrent_reads) {
 	}
 	virtual ~CheckpointWriter() {
 	}
 
 	//! The database
 	AttachedDatabase &db;
+	//! Whether or not other transactions can read the database while it is checkpointed, in which case the data of
+	//! a table is only written while its checkpoint lock is held exclusively
+	bool concurrent_reads;
 
 	virtual MetadataManager &GetMetadataManager() = 0;
 	virtual MetadataWriter &GetMetadataWriter() = 0;
@@ -96,7 +100,7 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileTableDataWriter;
 
 public:
-	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager);
+	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, bool concurrent_reads = false);
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
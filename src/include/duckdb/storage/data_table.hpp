@@ -183,6 +183,9 @@ public:
 
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	//! Rewrite the row groups of the table that contain deleted rows during the next checkpoint. Returns false if the
+	//! table cannot be compacted because it has indexes.
+	bool RequestVacuum();
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
@@ -25,6 +25,7 @@ struct MetadataHandle;
 struct StorageManagerOptions {
 	bool read_only = false;
 	bool use_direct_io = false;
+	bool use_io_uring = false;
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 };
 
@@ -57,6 +58,8 @@ public:
 	idx_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Read the content of a range of consecutive blocks from disk
+	void ReadBlocks(const vector<reference<Block>> &blocks) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
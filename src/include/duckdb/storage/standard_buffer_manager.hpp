@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -41,7 +42,7 @@ public:
 public:
 	static unique_ptr<StandardBufferManager> CreateBufferManager(DatabaseInstance &db, string temp_directory);
 	static unique_ptr<FileBuffer> ReadTemporaryBufferInternal(BufferManager &buffer_manager, FileHandle &handle,
-	                                                          idx_t position, idx_t size,
+	                                                          idx_t position, idx_t size, idx_t compressed_size,
 	                                                          unique_ptr<FileBuffer> reusable_buffer);
 	//! Registers an in-memory buffer that cannot be unloaded until it is destroyed
 	//! This buffer can be small (smaller than BLOCK_SIZE)
@@ -63,6 +64,8 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
+	//! Load the given (persistent) blocks into memory, submitting the reads of all blocks as a single batch
+	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
@@ -121,6 +124,8 @@ protected:
 	                                           unique_ptr<FileBuffer> buffer = nullptr) final;
 	//! Get the path of the temporary buffer
 	string GetTemporaryPath(block_id_t id);
+	//! Get the flags to open the file of a temporary buffer with
+	FileOpenFlags GetTemporaryFileFlags(FileOpenFlags flags);
 
 	void DeleteTemporaryFile(block_id_t id) final;
 
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+
+//! A register-blocked bloom filter over the hashes of the values of a column within a row group
+//! The filter is built during checkpointing, and used to skip row groups for equality and IN filters that cannot be
+//! answered by the min/max statistics (e.g. lookups on unsorted, high-cardinality columns)
+class BloomFilter {
+public:
+	explicit BloomFilter(idx_t word_count);
+
+	//! Creates a bloom filter that is sized for the given hashes. Note that the hashes are sorted and deduplicated.
+	static unique_ptr<BloomFilter> Create(vector<hash_t> &hashes);
+
+	void Insert(hash_t hash);
+	bool MightContain(hash_t hash) const;
+	//! Whether or not the value might be contained in the filter (the value must have the type of the column)
+	bool MightContain(const Value &value) const;
+	//! Whether or not any of the values might be contained in the filter
+	bool MightContainAny(const vector<Value> &values) const;
+
+	idx_t GetWordCount() const {
+		return words.size();
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+	//! Whether or not bloom filters can be created for columns of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+public:
+	//! The amount of bits that are reserved in the filter for every distinct value
+	static constexpr const idx_t BITS_PER_VALUE = 10;
+	//! The version of the hash function the filter is built with (VectorOperations::Hash)
+	//! This must be incremented when VectorOperations::Hash changes: filters with another version are ignored
+	static constexpr const idx_t HASH_VERSION = 1;
+
+private:
+	idx_t GetWordIndex(hash_t hash) const;
+	static uint64_t GetMask(hash_t hash);
+	//! Returns a combination of the hashes of fixed values, which is stored to detect unversioned hash changes
+	static hash_t GetHashCheck();
+
+private:
+	//! The bits of the filter, every value sets bits in a single word
+	unsafe_vector<uint64_t> words;
+};
+
+} // namespace duckdb
@@ -35,6 +35,8 @@ public:
 
 	//! Get an exclusive lock
 	unique_ptr<StorageLockKey> GetExclusiveLock();
+	//! Try to get an exclusive lock without waiting, returns nullptr if the lock is held by anyone else
+	unique_ptr<StorageLockKey> TryGetExclusiveLock();
 	//! Get a shared lock
 	unique_ptr<StorageLockKey> GetSharedLock();
 
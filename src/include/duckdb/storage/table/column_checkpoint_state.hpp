@@ -18,6 +18,7 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class DatabaseInstance;
 class RowGroup;
@@ -33,6 +34,8 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! The bloom filter over the values of the column (if any)
+	shared_ptr<BloomFilter> bloom_filter;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -18,6 +18,7 @@
 #include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -82,6 +83,10 @@ public:
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
 	virtual void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx);
+	//! Collect the on-disk blocks that a scan of the rows [row_start, row_start + count) reads
+	virtual void InitializePrefetch(PrefetchState &prefetch_state, idx_t row_start, idx_t count);
+	//! Remove the rows of the segments that the filter prunes based on their zonemaps from the given row ranges
+	void FilterPrefetchRanges(TableFilter &filter, vector<pair<idx_t, idx_t>> &row_ranges);
 	//! Scan the next vector from the column
 	virtual idx_t Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
 	virtual idx_t ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates);
@@ -138,6 +143,8 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	bool CheckZonemap(TableFilter &filter);
+	//! Returns the bloom filter over the values of the column (if any)
+	shared_ptr<BloomFilter> GetBloomFilter() const;
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -160,6 +167,13 @@ protected:
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
+	//! Returns the amount of rows in the vector with the given index
+	idx_t GetVectorCount(idx_t vector_index) const;
+	//! Whether or not the filter can be evaluated on the compressed data of the next vector of the scan
+	bool CanFilterCompressed(ColumnScanState &state, idx_t scan_count, const TableFilter &filter);
+	//! Scans a base vector from the column while evaluating the filter on the compressed data
+	void FilterVector(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel, idx_t &sel_count,
+	                  const TableFilter &filter);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
@@ -177,6 +191,9 @@ protected:
 	unique_ptr<UpdateSegment> updates;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The bloom filter over the values of the column, built at checkpoint (protected by the update_lock)
+	//! The bloom filter is discarded when the column is appended to or updated
+	shared_ptr<BloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
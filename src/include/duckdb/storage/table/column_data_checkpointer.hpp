@@ -36,6 +36,8 @@ private:
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
+	//! Whether or not a bloom filter should be built over the values of the column
+	bool ShouldBuildBloomFilter();
 
 private:
 	ColumnData &col_data;
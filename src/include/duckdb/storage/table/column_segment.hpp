@@ -29,6 +29,7 @@ class UpdateSegment;
 class TableFilter;
 struct ColumnFetchState;
 struct ColumnScanState;
+struct PrefetchState;
 struct ColumnAppendState;
 
 enum class ColumnSegmentType : uint8_t { TRANSIENT, PERSISTENT };
@@ -63,8 +64,13 @@ public:
 
 public:
 	void InitializeScan(ColumnScanState &state);
+	//! Add the block of this segment to the set of blocks that a scan is going to read
+	void InitializePrefetch(PrefetchState &prefetch_state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, bool entire_vector);
+	//! Scan one vector from this segment while evaluating the filter on the compressed data
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel, idx_t &sel_count,
+	            const TableFilter &filter);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/table/table_index_list.hpp"
 
 namespace duckdb {
@@ -38,6 +39,9 @@ struct DataTableInfo {
 	TableIndexList indexes;
 	//! Index storage information of the indexes created by this table
 	vector<IndexStorageInfo> index_storage_infos;
+	//! Scans hold a shared lock for their duration, a checkpoint that runs alongside other transactions holds an
+	//! exclusive lock while it rewrites the data of the table
+	StorageLock checkpoint_lock;
 
 	bool IsTemporary() const;
 };
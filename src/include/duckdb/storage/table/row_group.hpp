@@ -88,6 +88,10 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Read ahead the blocks of the next row group, if the scan is going to scan it after this row group
+	void PrefetchNextRowGroup(CollectionScanState &state);
+	//! Load the blocks of the projected columns that a scan of this row group reads into memory
+	void Prefetch(CollectionScanState &state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids);
@@ -121,6 +125,11 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	idx_t GetColumnCount() const;
+	//! Checkpoint a single column of the row group. Different columns of a row group can be written concurrently.
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(RowGroupWriter &writer, idx_t column_idx);
+	//! Set the statistics of the write data from the checkpoint states of its columns
+	static void InitializeWriteStatistics(RowGroupWriteData &write_data);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
@@ -155,11 +164,13 @@ public:
 	static RowGroupPointer Deserialize(Deserializer &deserializer);
 
 private:
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(PartialBlockManager &manager, idx_t column_idx,
+	                                                    CompressionType compression_type);
+
 	shared_ptr<RowVersionManager> &GetVersionInfo();
 	shared_ptr<RowVersionManager> &GetOrCreateVersionInfoPtr();
 
 	ColumnData &GetColumn(storage_t c);
-	idx_t GetColumnCount() const;
 	vector<shared_ptr<ColumnData>> &GetColumns();
 
 	template <TableScanType TYPE>
@@ -89,6 +89,8 @@ public:
 	                  DataChunk &updates);
 
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Request that the next checkpoint rewrites the row groups in which a significant part of the rows is deleted
+	void RequestVacuum();
 
 	void InitializeVacuumState(VacuumState &state, vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
@@ -143,6 +145,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! Whether or not a VACUUM was requested that has not been performed by a checkpoint yet
+	atomic<bool> vacuum_requested;
 };
 
 } // namespace duckdb
@@ -16,6 +16,7 @@
 #include "duckdb/storage/table/segment_lock.hpp"
 
 namespace duckdb {
+class BlockHandle;
 class ColumnSegment;
 class LocalTableStorage;
 class CollectionScanState;
@@ -100,6 +101,13 @@ public:
 	void NextInternal(idx_t count);
 };
 
+struct PrefetchState {
+	//! The blocks that are going to be read by the scan
+	vector<shared_ptr<BlockHandle>> blocks;
+
+	void AddBlock(shared_ptr<BlockHandle> block);
+};
+
 struct ColumnFetchState {
 	//! The set of pinned block handles for this set of fetches
 	buffer_handle_set_t handles;
@@ -127,6 +135,8 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The amount of row groups for which a scan was initialized with this state
+	idx_t initialized_row_groups;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -145,12 +155,16 @@ private:
 struct TableScanOptions {
 	//! Test config that forces fetching rows one by one instead of regular scans
 	bool force_fetch_row = false;
+	//! Whether or not the blocks of the next row group are read ahead while a row group is scanned
+	bool prefetch = false;
 };
 
 class TableScanState {
 public:
 	TableScanState() : table_state(*this), local_state(*this), table_filters(nullptr) {};
 
+	//! The shared checkpoint lock of the table, held for the duration of the scan
+	shared_ptr<StorageLockKey> checkpoint_lock;
 	//! The underlying table scan state
 	CollectionScanState table_state;
 	//! Transaction-local scan state
@@ -188,6 +202,8 @@ struct ParallelCollectionScanState {
 };
 
 struct ParallelTableScanState {
+	//! The shared checkpoint lock of the table, held for the duration of the scan
+	shared_ptr<StorageLockKey> checkpoint_lock;
 	//! Parallel scan state for the table
 	ParallelCollectionScanState scan_state;
 	//! Parallel scan state for the transaction-local state
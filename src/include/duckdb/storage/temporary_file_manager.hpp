@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +48,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block in the file, used to keep track of the size of the file on disk
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -61,6 +63,8 @@ struct TemporaryFileIndex {
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The size of the block in the file if it is compressed, or 0 if it is stored uncompressed
+	idx_t compressed_size;
 
 public:
 	bool IsValid() const;
@@ -75,7 +79,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t block_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +92,14 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(TemporaryFileIndex index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetBlockSize() const {
+		return block_size;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -104,6 +111,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of the slot of a block in the file - compressed blocks are stored in files with smaller slots
+	const idx_t block_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -158,6 +167,14 @@ public:
 	//! Register temporary file size decrease
 	void DecreaseSizeOnDisk(idx_t amount);
 
+	//! Compresses the contents of the buffer into compressed_buffer, if temporary file compression is enabled and
+	//! compression sufficiently reduces the size. Returns the compressed size, or 0 if the buffer was not compressed.
+	static idx_t CompressBuffer(DatabaseInstance &db, FileBuffer &buffer, AllocatedData &compressed_buffer);
+	//! Decompresses the compressed contents of a buffer into the buffer
+	static void DecompressBuffer(const_data_ptr_t compressed_data, idx_t compressed_size, FileBuffer &buffer);
+	//! Returns the size of the slot in a temporary file that a block with the given compressed size is stored in
+	static idx_t GetTemporaryBlockSize(idx_t compressed_size);
+
 private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
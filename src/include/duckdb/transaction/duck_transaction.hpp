@@ -9,9 +9,12 @@
 #pragma once
 
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 
 namespace duckdb {
 class RowVersionManager;
+struct DataTableInfo;
 
 class DuckTransaction : public Transaction {
 public:
@@ -29,6 +32,9 @@ public:
 	unordered_map<SequenceCatalogEntry *, SequenceValue> sequence_usage;
 	//! Highest active query when the transaction finished, used for cleaning up
 	transaction_t highest_active_query;
+	//! The shared write lock of the transaction manager, held while the transaction can modify the database so that
+	//! the background checkpointer does not checkpoint concurrently
+	unique_ptr<StorageLockKey> write_lock;
 
 public:
 	static DuckTransaction &Get(ClientContext &context, AttachedDatabase &db);
@@ -50,6 +56,10 @@ public:
 
 	bool ChangesMade();
 
+	void SetReadWrite() override;
+	//! Returns a shared checkpoint lock of the table, the scans of the transaction share a single lock per table
+	shared_ptr<StorageLockKey> SharedLockTable(DataTableInfo &info);
+
 	void PushDelete(DataTable &table, RowVersionManager &info, idx_t vector_idx, row_t rows[], idx_t count,
 	                idx_t base_row);
 	void PushAppend(DataTable &table, idx_t row_start, idx_t row_count);
@@ -65,6 +75,9 @@ private:
 	UndoBuffer undo_buffer;
 	//! The set of uncommitted appends for the transaction
 	unique_ptr<LocalStorage> storage;
+	//! The shared checkpoint locks of the tables that are being scanned by this transaction
+	reference_map_t<DataTableInfo, weak_ptr<StorageLockKey>> active_locks;
+	mutex active_locks_lock;
 };
 
 } // namespace duckdb
@@ -8,8 +8,13 @@
 
 #pragma once
 
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class DuckTransaction;
 
@@ -33,6 +38,9 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Checkpoint the database, also if the WAL is empty, so that the tables for which a VACUUM was requested are
+	//! compacted. If a checkpoint is not possible right now, the compaction is left to the next checkpoint.
+	void Vacuum(ClientContext &context);
 
 	transaction_t LowestActiveId() {
 		return lowest_active_id;
@@ -45,6 +53,12 @@ public:
 		return true;
 	}
 
+	//! Stop the background checkpointer, waiting for a checkpoint that is in progress to finish
+	void StopBackgroundCheckpointer();
+	//! Returns a shared write lock, which transactions hold while they can modify the database. Waits for a background
+	//! checkpoint that is in progress to finish.
+	unique_ptr<StorageLockKey> SharedWriteLock();
+
 protected:
 	struct CheckpointDecision {
 		bool can_checkpoint;
@@ -56,6 +70,17 @@ private:
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction) noexcept;
 
+	//! Whether or not automatic checkpoints are performed by the background checkpointer
+	bool BackgroundCheckpointEnabled();
+	//! Request a checkpoint from the background checkpointer, starting it if it is not running yet
+	void RequestBackgroundCheckpoint();
+	//! Wake up the background checkpointer if it is waiting to retry a checkpoint
+	void NotifyBackgroundCheckpointer() noexcept;
+	void RunBackgroundCheckpointer();
+	//! Checkpoint if no transaction can modify the database and all active transactions see the latest committed
+	//! state, returns false if the checkpoint has to be retried later
+	bool TryBackgroundCheckpoint();
+
 private:
 	//! The current start timestamp used by transactions
 	transaction_t current_start_timestamp;
@@ -75,6 +100,24 @@ private:
 	mutex transaction_lock;
 
 	bool thread_is_checkpointing;
+	//! Transactions that can modify the database hold a shared lock, the background checkpointer holds it exclusively
+	StorageLock write_lock;
+
+	//! The background checkpointer runs the automatic checkpoints once no transactions can modify the database, so
+	//! that the transaction that exceeds the checkpoint threshold does not have to wait for the checkpoint. Other
+	//! transactions can start, read and commit while it checkpoints.
+	unique_ptr<thread> checkpointer;
+	//! The lock for the state of the background checkpointer
+	mutex checkpointer_lock;
+	std::condition_variable checkpointer_cv;
+	//! Whether or not a checkpoint was requested that has not been performed yet
+	bool checkpoint_requested;
+	//! Whether or not the background checkpointer should check if it can checkpoint
+	bool checkpointer_signaled;
+	bool checkpointer_shutdown;
+	//! The error of a failed background checkpoint that did not invalidate the database (protected by the
+	//! transaction_lock), it is thrown by the next CHECKPOINT
+	ErrorData background_checkpoint_error;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
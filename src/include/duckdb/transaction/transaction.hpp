@@ -54,6 +54,8 @@ public:
 
 	//! Whether or not the transaction has made any modifications to the database so far
 	DUCKDB_API bool IsReadOnly();
+	//! Called when the transaction is about to modify the database for the first time
+	DUCKDB_API virtual void SetReadWrite();
 
 	virtual bool IsDuckTransaction() const {
 		return false;
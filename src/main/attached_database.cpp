@@ -149,6 +149,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// stop checkpointing in the background before we write the final checkpoint
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpointer();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
@@ -57,6 +57,7 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_LOCAL(DebugForceExternal),
@@ -71,6 +72,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
     DUCKDB_GLOBAL(EnableFSSTVectors),
+    DUCKDB_GLOBAL(EnableCheckpointBloomFilters),
+    DUCKDB_GLOBAL(EnableBackgroundCheckpointSetting),
+    DUCKDB_GLOBAL(EnableHugePageAllocationSetting),
+    DUCKDB_GLOBAL(EnableIOUringSetting),
+    DUCKDB_GLOBAL(EnableTempFileCompression),
     DUCKDB_GLOBAL(AllowUnsignedExtensionsSetting),
     DUCKDB_GLOBAL(AllowExtensionsMetadataMismatchSetting),
     DUCKDB_GLOBAL(AllowUnredactedSecretsSetting),
@@ -83,6 +89,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
+    DUCKDB_LOCAL(EnableTableScanPrefetchSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
@@ -118,6 +125,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
     DUCKDB_GLOBAL(ThreadsSetting),
+    DUCKDB_GLOBAL(UseDirectIOSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
@@ -377,6 +377,10 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory);
 	}
+	config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
+	config.buffer_pool->GetBlockAllocator().SetHugePageAllocation(config.options.enable_huge_page_allocation);
+	config.buffer_pool->GetBlockAllocator().SetAlignedAllocation(config.options.use_direct_io);
+	config.buffer_pool->GetBlockAllocator().SetDatabaseAllocator(*config.allocator);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
@@ -89,6 +89,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::UNGROUPED_AGGREGATE:
 	case PhysicalOperatorType::HASH_GROUP_BY:
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
 	case PhysicalOperatorType::COPY_TO_FILE:
@@ -122,6 +123,13 @@ void QueryProfiler::Finalize(TreeNode &node) {
 	}
 }
 
+void QueryProfiler::UpdateExtraInfo() {
+	lock_guard<mutex> guard(flush_lock);
+	for (auto &entry : tree_map) {
+		entry.second.get().extra_info = entry.first.get().ParamsToString();
+	}
+}
+
 void QueryProfiler::StartExplainAnalyze() {
 	this->is_explain_analyze = true;
 }
@@ -13,6 +13,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -78,6 +79,45 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	BufferEvictionPolicy policy;
+	if (parameter == "lru") {
+		policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", parameter);
+	}
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(policy);
+	}
+	config.options.buffer_eviction_policy = policy;
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -453,6 +493,92 @@ Value EnableFSSTVectors::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_fsst_vectors);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Checkpoint Bloom Filters
+//===--------------------------------------------------------------------===//
+void EnableCheckpointBloomFilters::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_checkpoint_bloom_filters = input.GetValue<bool>();
+}
+
+void EnableCheckpointBloomFilters::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_checkpoint_bloom_filters = DBConfig().options.enable_checkpoint_bloom_filters;
+}
+
+Value EnableCheckpointBloomFilters::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_checkpoint_bloom_filters);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Background Checkpoint
+//===--------------------------------------------------------------------===//
+void EnableBackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_background_checkpoint = input.GetValue<bool>();
+}
+
+void EnableBackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_background_checkpoint = DBConfig().options.enable_background_checkpoint;
+}
+
+Value EnableBackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Huge Page Allocation
+//===--------------------------------------------------------------------===//
+void EnableHugePageAllocationSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_huge_page_allocation = input.GetValue<bool>();
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetHugePageAllocation(config.options.enable_huge_page_allocation);
+	}
+}
+
+void EnableHugePageAllocationSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_huge_page_allocation = DBConfig().options.enable_huge_page_allocation;
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetHugePageAllocation(config.options.enable_huge_page_allocation);
+	}
+}
+
+Value EnableHugePageAllocationSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_huge_page_allocation);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable IO Uring
+//===--------------------------------------------------------------------===//
+void EnableIOUringSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_io_uring = input.GetValue<bool>();
+}
+
+void EnableIOUringSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_io_uring = DBConfig().options.enable_io_uring;
+}
+
+Value EnableIOUringSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_io_uring);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Temp File Compression
+//===--------------------------------------------------------------------===//
+void EnableTempFileCompression::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_temp_file_compression = input.GetValue<bool>();
+}
+
+void EnableTempFileCompression::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_temp_file_compression = DBConfig().options.enable_temp_file_compression;
+}
+
+Value EnableTempFileCompression::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Unsigned Extensions
 //===--------------------------------------------------------------------===//
@@ -694,6 +820,21 @@ Value EnableProgressBarPrintSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Table Scan Prefetch
+//===--------------------------------------------------------------------===//
+void EnableTableScanPrefetchSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_table_scan_prefetch = BooleanValue::Get(input);
+}
+
+void EnableTableScanPrefetchSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_table_scan_prefetch = ClientConfig().enable_table_scan_prefetch;
+}
+
+Value EnableTableScanPrefetchSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_table_scan_prefetch);
+}
+
 //===--------------------------------------------------------------------===//
 // Errors As JSON
 //===--------------------------------------------------------------------===//
@@ -1363,6 +1504,28 @@ Value ThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(config.options.maximum_threads));
 }
 
+//===--------------------------------------------------------------------===//
+// Use Direct IO
+//===--------------------------------------------------------------------===//
+void UseDirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.use_direct_io = input.GetValue<bool>();
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetAlignedAllocation(config.options.use_direct_io);
+	}
+}
+
+void UseDirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetAlignedAllocation(config.options.use_direct_io);
+	}
+}
+
+Value UseDirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
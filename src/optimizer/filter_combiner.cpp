@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -571,41 +572,61 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 
 			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
 			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
-				continue;
-			}
+			if (type.IsIntegral()) {
+				bool can_simplify_in_clause = true;
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					if (const_value_expr.value.IsNull()) {
+						can_simplify_in_clause = false;
+						break;
+					}
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+				if (can_simplify_in_clause && !in_values.empty()) {
+					sort(in_values.begin(), in_values.end());
 
-			bool can_simplify_in_clause = true;
-			for (idx_t i = 1; i < func.children.size(); i++) {
-				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
-				if (const_value_expr.value.IsNull()) {
-					can_simplify_in_clause = false;
-					break;
+					for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+						if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+							can_simplify_in_clause = false;
+							break;
+						}
+					}
+				}
+				if (can_simplify_in_clause && !in_values.empty()) {
+					auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+					                                             Value::Numeric(type, in_values.front()));
+					auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
+					                                             Value::Numeric(type, in_values.back()));
+					table_filters.PushFilter(column_index, std::move(lower_bound));
+					table_filters.PushFilter(column_index, std::move(upper_bound));
+					table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+
+					remaining_filters.erase_at(rem_fil_idx);
+					continue;
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+
+			//! Otherwise we push the IN list into the scan as a set membership filter
+			// NULL values in the list can never produce a match, so they are dropped from the set
+			if (!InFilter::SupportsType(column_ref.return_type)) {
 				continue;
 			}
-
-			sort(in_values.begin(), in_values.end());
-
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
+			bool can_push_in_filter = true;
+			vector<Value> set_values;
+			for (idx_t i = 1; i < func.children.size(); i++) {
+				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+				if (const_value_expr.value.type() != column_ref.return_type) {
+					can_push_in_filter = false;
 					break;
 				}
+				if (!const_value_expr.value.IsNull()) {
+					set_values.push_back(const_value_expr.value);
+				}
 			}
-			if (!can_simplify_in_clause) {
+			if (!can_push_in_filter || set_values.empty()) {
 				continue;
 			}
-			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.front()));
-			auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.back()));
-			table_filters.PushFilter(column_index, std::move(lower_bound));
-			table_filters.PushFilter(column_index, std::move(upper_bound));
-			table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+			table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(set_values)));
 
 			remaining_filters.erase_at(rem_fil_idx);
 		}
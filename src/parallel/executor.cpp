@@ -2,6 +2,7 @@
 
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/set/physical_cte.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -152,7 +153,12 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 		if (source->type == PhysicalOperatorType::TABLE_SCAN) {
 			// we have to reset the source here (in the main thread), because some of our clients (looking at you, R)
 			// do not like it when threads other than the main thread call into R, for e.g., arrow scans
-			pipeline->ResetSource(true);
+			// scans that receive runtime filters are initialized when they are scheduled instead, i.e., after the
+			// operators that push the filters have finished
+			auto &table_scan = source->Cast<PhysicalTableScan>();
+			if (!table_scan.dynamic_filters) {
+				pipeline->ResetSource(true);
+			}
 		}
 
 		auto dependencies = meta_pipeline->GetDependencies(*pipeline);
@@ -16,6 +16,10 @@
 #include <queue>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <sched.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -276,6 +280,21 @@ void TaskScheduler::YieldThread() {
 #endif
 }
 
+idx_t TaskScheduler::GetEstimatedCPUId() {
+#ifdef DUCKDB_NO_THREADS
+	return 0;
+#else
+#ifdef __linux__
+	auto cpu = sched_getcpu();
+	if (cpu >= 0) {
+		return NumericCast<idx_t>(cpu);
+	}
+#endif
+	// not available: use a hash of the thread id instead
+	return std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+}
+
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
@@ -0,0 +1,201 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+struct InFilterSet {
+	virtual ~InFilterSet() {
+	}
+
+	virtual idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const = 0;
+};
+
+template <class T>
+struct InFilterHashFunction {
+	size_t operator()(const T &value) const {
+		return Hash<T>(value);
+	}
+};
+
+template <class T>
+struct InFilterEquality {
+	bool operator()(const T &a, const T &b) const {
+		return Equals::Operation<T>(a, b);
+	}
+};
+
+template <class T>
+struct TemplatedInFilterSet : public InFilterSet {
+	explicit TemplatedInFilterSet(const vector<Value> &values) {
+		// for strings the set references the string data owned by the values of the filter
+		for (auto &value : values) {
+			set.insert(value.GetValueUnsafe<T>());
+		}
+	}
+
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const override {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		SelectionVector new_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			auto vector_idx = vdata.sel->get_index(idx);
+			if (vdata.validity.RowIsValid(vector_idx) && set.find(data[vector_idx]) != set.end()) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(new_sel);
+		approved_tuple_count = result_count;
+		return result_count;
+	}
+
+	unordered_set<T, InFilterHashFunction<T>, InFilterEquality<T>> set;
+};
+
+static unique_ptr<InFilterSet> CreateInFilterSet(PhysicalType type, const vector<Value> &values) {
+	switch (type) {
+	case PhysicalType::BOOL:
+		return make_uniq<TemplatedInFilterSet<bool>>(values);
+	case PhysicalType::UINT8:
+		return make_uniq<TemplatedInFilterSet<uint8_t>>(values);
+	case PhysicalType::UINT16:
+		return make_uniq<TemplatedInFilterSet<uint16_t>>(values);
+	case PhysicalType::UINT32:
+		return make_uniq<TemplatedInFilterSet<uint32_t>>(values);
+	case PhysicalType::UINT64:
+		return make_uniq<TemplatedInFilterSet<uint64_t>>(values);
+	case PhysicalType::UINT128:
+		return make_uniq<TemplatedInFilterSet<uhugeint_t>>(values);
+	case PhysicalType::INT8:
+		return make_uniq<TemplatedInFilterSet<int8_t>>(values);
+	case PhysicalType::INT16:
+		return make_uniq<TemplatedInFilterSet<int16_t>>(values);
+	case PhysicalType::INT32:
+		return make_uniq<TemplatedInFilterSet<int32_t>>(values);
+	case PhysicalType::INT64:
+		return make_uniq<TemplatedInFilterSet<int64_t>>(values);
+	case PhysicalType::INT128:
+		return make_uniq<TemplatedInFilterSet<hugeint_t>>(values);
+	case PhysicalType::FLOAT:
+		return make_uniq<TemplatedInFilterSet<float>>(values);
+	case PhysicalType::DOUBLE:
+		return make_uniq<TemplatedInFilterSet<double>>(values);
+	case PhysicalType::VARCHAR:
+		return make_uniq<TemplatedInFilterSet<string_t>>(values);
+	default:
+		throw InternalException("Unsupported type for InFilter");
+	}
+}
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	auto &type = values[0].type();
+	if (!SupportsType(type)) {
+		throw InternalException("Unsupported type \"%s\" for InFilter", type.ToString());
+	}
+	for (auto &value : values) {
+		if (value.IsNull() || value.type() != type) {
+			throw InternalException("InFilter values must be non-NULL and of the same type");
+		}
+		if (min_value.IsNull() || value < min_value) {
+			min_value = value;
+		}
+		if (max_value.IsNull() || value > max_value) {
+			max_value = value;
+		}
+	}
+	set = CreateInFilterSet(type.InternalType(), values);
+}
+
+InFilter::~InFilter() {
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+idx_t InFilter::Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const {
+	return set->Select(vdata, sel, approved_tuple_count);
+}
+
+static FilterPropagateResult CheckZonemap(BaseStatistics &stats, ExpressionType comparison_type, const Value &constant) {
+	if (constant.type().InternalType() == PhysicalType::VARCHAR) {
+		return StringStats::CheckZonemap(stats, comparison_type, StringValue::Get(constant));
+	}
+	return NumericStats::CheckZonemap(stats, comparison_type, constant);
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(min_value.type().id() == stats.GetType().id());
+	if (min_value.type().InternalType() == PhysicalType::BOOL) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// first check if the zonemap overlaps with the range spanned by the set
+	if (CheckZonemap(stats, ExpressionType::COMPARE_GREATERTHANOREQUALTO, min_value) ==
+	        FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+	    CheckZonemap(stats, ExpressionType::COMPARE_LESSTHANOREQUALTO, max_value) ==
+	        FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	if (values.size() > MAX_INDIVIDUAL_ZONEMAP_CHECKS) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// for small sets the zonemap can fall in between the values of the set
+	for (auto &value : values) {
+		if (CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			in_list += ", ";
+		}
+		in_list += values[i].ToString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+} // namespace duckdb
@@ -0,0 +1,302 @@
+#include "duckdb/storage/buffer/block_allocator.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+
+#if defined(__linux__) && !defined(DUCKDB_NO_HUGE_PAGE_ALLOCATION)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// MAP_TYPE clashes with a template parameter name used in the unity build
+#undef MAP_TYPE
+#if defined(MADV_HUGEPAGE) && defined(SYS_getcpu) && defined(SYS_mbind)
+#define DUCKDB_HUGE_PAGE_ALLOCATION
+// MPOL_PREFERRED from <linux/mempolicy.h>: allocate on the given node, but fall back to other nodes when it is full
+#define DUCKDB_MPOL_PREFERRED 1
+#endif
+#endif
+
+namespace duckdb {
+
+struct BlockAllocatorData : PrivateAllocatorData {
+	explicit BlockAllocatorData(BlockAllocator &block_allocator) : block_allocator(block_allocator) {
+	}
+
+	BlockAllocator &block_allocator;
+};
+
+BlockAllocator::BlockAllocator()
+    : allocator(BlockAllocatorAllocate, BlockAllocatorFree, BlockAllocatorRealloc,
+                make_uniq<BlockAllocatorData>(*this)),
+      enabled(false), aligned_allocation(false), aligned_pointer_count(0),
+      aligned_pointers(make_uniq_array<AlignedPointers>(ALIGNED_POINTER_PARTITIONS)), mapping(nullptr),
+      mapping_size(0), arena(nullptr), arena_size(0), chunk_count(0), next_chunk(0),
+      numa_nodes(make_uniq_array<NUMANodeBlocks>(MAX_NUMA_NODES)) {
+}
+
+BlockAllocator::~BlockAllocator() {
+#ifdef DUCKDB_HUGE_PAGE_ALLOCATION
+	if (mapping) {
+		munmap(mapping, mapping_size);
+	}
+#endif
+}
+
+Allocator &BlockAllocator::Get(DatabaseInstance &db) {
+	auto &block_allocator = BufferManager::GetBufferManager(db).GetBufferPool().GetBlockAllocator();
+	if (block_allocator.IsEnabled()) {
+		return block_allocator.GetAllocator();
+	}
+	return Allocator::Get(db);
+}
+
+void BlockAllocator::SetHugePageAllocation(bool enable) {
+	if (!enable) {
+		// blocks that were allocated from the arena are still returned to it when they are freed
+		enabled = false;
+		return;
+	}
+	lock_guard<mutex> guard(arena_lock);
+	if (!arena && !ReserveArena()) {
+		return;
+	}
+	enabled = true;
+}
+
+void BlockAllocator::SetDatabaseAllocator(Allocator &database_allocator_p) {
+	database_allocator = &database_allocator_p;
+}
+
+void BlockAllocator::SetAlignedAllocation(bool enable) {
+	aligned_allocation = enable;
+}
+
+//===--------------------------------------------------------------------===//
+// NUMA
+//===--------------------------------------------------------------------===//
+static idx_t GetCurrentNUMANode() {
+#ifdef DUCKDB_HUGE_PAGE_ALLOCATION
+	unsigned cpu;
+	unsigned node;
+	if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+		return node % BlockAllocator::MAX_NUMA_NODES;
+	}
+#endif
+	return 0;
+}
+
+static void BindToNUMANode(data_ptr_t pointer, idx_t size, idx_t numa_node) {
+#ifdef DUCKDB_HUGE_PAGE_ALLOCATION
+	static constexpr idx_t BITS_PER_MASK = sizeof(unsigned long) * 8;
+	unsigned long node_mask[BlockAllocator::MAX_NUMA_NODES / BITS_PER_MASK] = {};
+	node_mask[numa_node / BITS_PER_MASK] = 1UL << (numa_node % BITS_PER_MASK);
+	// this is a hint: if it fails (e.g., in a container without permission), the memory is placed on first touch
+	syscall(SYS_mbind, pointer, size, DUCKDB_MPOL_PREFERRED, node_mask, BlockAllocator::MAX_NUMA_NODES + 1, 0);
+#endif
+}
+
+//===--------------------------------------------------------------------===//
+// Arena
+//===--------------------------------------------------------------------===//
+bool BlockAllocator::ReserveArena() {
+#ifdef DUCKDB_HUGE_PAGE_ALLOCATION
+	// reserve twice the physical memory of virtual address space: pages are only backed by memory when they are used
+	auto physical_memory = FileSystem::GetAvailableMemory();
+	idx_t size = physical_memory.IsValid() ? 2 * physical_memory.GetIndex() : 64ULL * 1024ULL * 1024ULL * 1024ULL;
+	size = AlignValue<idx_t, CHUNK_SIZE>(size);
+
+	// mmap does not align to huge pages: map an additional chunk so we can align the start of the arena
+	auto mapping_p = mmap(nullptr, size + CHUNK_SIZE, PROT_READ | PROT_WRITE,
+	                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (mapping_p == MAP_FAILED) {
+		return false;
+	}
+	mapping = mapping_p;
+	mapping_size = size + CHUNK_SIZE;
+	arena = reinterpret_cast<data_ptr_t>(AlignValue<uintptr_t, CHUNK_SIZE>(reinterpret_cast<uintptr_t>(mapping)));
+	arena_size = size;
+	// this fails if transparent huge pages are disabled, in which case the arena is backed by regular pages
+	madvise(arena, arena_size, MADV_HUGEPAGE);
+
+	chunk_count = arena_size / CHUNK_SIZE;
+	chunks = make_uniq_array<ArenaChunk>(chunk_count);
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool BlockAllocator::AllocateChunk(idx_t numa_node) {
+	auto chunk_idx = next_chunk++;
+	if (chunk_idx >= chunk_count) {
+		// the arena is exhausted
+		next_chunk = chunk_count;
+		return false;
+	}
+	auto chunk_ptr = arena + chunk_idx * CHUNK_SIZE;
+	BindToNUMANode(chunk_ptr, CHUNK_SIZE, numa_node);
+	chunks[chunk_idx].numa_node = numa_node;
+	chunks[chunk_idx].used_blocks = 0;
+
+	// add the blocks in reverse, so they are handed out in order of their address
+	auto &free_blocks = numa_nodes[numa_node].free_blocks;
+	for (idx_t block_idx = BLOCKS_PER_CHUNK; block_idx > 0; block_idx--) {
+		free_blocks.push_back(chunk_ptr + (block_idx - 1) * Storage::BLOCK_ALLOC_SIZE);
+	}
+	return true;
+}
+
+bool BlockAllocator::IsArenaPointer(data_ptr_t pointer) const {
+	return arena && pointer >= arena && pointer < arena + arena_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Allocation
+//===--------------------------------------------------------------------===//
+static data_ptr_t AllocateAligned(idx_t size) {
+#ifdef _WIN32
+	return data_ptr_cast(_aligned_malloc(size, Storage::SECTOR_SIZE));
+#else
+	void *pointer;
+	if (posix_memalign(&pointer, Storage::SECTOR_SIZE, size) != 0) {
+		return nullptr;
+	}
+	return data_ptr_cast(pointer);
+#endif
+}
+
+static void FreeAligned(data_ptr_t pointer) {
+#ifdef _WIN32
+	_aligned_free(pointer);
+#else
+	free(pointer);
+#endif
+}
+
+Allocator &BlockAllocator::GetDatabaseAllocator() {
+	return database_allocator ? *database_allocator : Allocator::DefaultAllocator();
+}
+
+data_ptr_t BlockAllocator::AllocateNonArenaData(idx_t size) {
+	if (!aligned_allocation) {
+		return GetDatabaseAllocator().AllocateData(size);
+	}
+	auto pointer = AllocateAligned(size);
+	if (pointer) {
+		// the pointer has to be freed with FreeAligned, even if aligned allocation is disabled in the meantime
+		auto &partition = GetAlignedPointers(pointer);
+		lock_guard<mutex> guard(partition.lock);
+		partition.pointers.insert(pointer);
+		aligned_pointer_count++;
+	}
+	return pointer;
+}
+
+void BlockAllocator::FreeNonArenaData(data_ptr_t pointer, idx_t size) {
+	if (IsAlignedPointer(pointer, true)) {
+		FreeAligned(pointer);
+		return;
+	}
+	GetDatabaseAllocator().FreeData(pointer, size);
+}
+
+BlockAllocator::AlignedPointers &BlockAllocator::GetAlignedPointers(data_ptr_t pointer) {
+	// aligned pointers are multiples of the sector size: the bits below it do not tell them apart
+	auto address = reinterpret_cast<uintptr_t>(pointer) / Storage::SECTOR_SIZE;
+	return aligned_pointers[address % ALIGNED_POINTER_PARTITIONS];
+}
+
+bool BlockAllocator::IsAlignedPointer(data_ptr_t pointer, bool erase) {
+	if (aligned_pointer_count == 0) {
+		return false;
+	}
+	auto &partition = GetAlignedPointers(pointer);
+	lock_guard<mutex> guard(partition.lock);
+	auto entry = partition.pointers.find(pointer);
+	if (entry == partition.pointers.end()) {
+		return false;
+	}
+	if (erase) {
+		partition.pointers.erase(entry);
+		aligned_pointer_count--;
+	}
+	return true;
+}
+
+data_ptr_t BlockAllocator::AllocateData(idx_t size) {
+	if (size != Storage::BLOCK_ALLOC_SIZE || !enabled) {
+		return AllocateNonArenaData(size);
+	}
+	auto numa_node = GetCurrentNUMANode();
+	auto &node = numa_nodes[numa_node];
+	lock_guard<mutex> guard(node.lock);
+	if (node.free_blocks.empty() && !AllocateChunk(numa_node)) {
+		return AllocateNonArenaData(size);
+	}
+	auto pointer = node.free_blocks.back();
+	node.free_blocks.pop_back();
+	chunks[NumericCast<idx_t>(pointer - arena) / CHUNK_SIZE].used_blocks++;
+	return pointer;
+}
+
+void BlockAllocator::FreeData(data_ptr_t pointer, idx_t size) {
+	if (!IsArenaPointer(pointer)) {
+		FreeNonArenaData(pointer, size);
+		return;
+	}
+	D_ASSERT(size == Storage::BLOCK_ALLOC_SIZE);
+	auto chunk_idx = NumericCast<idx_t>(pointer - arena) / CHUNK_SIZE;
+	auto &chunk = chunks[chunk_idx];
+	auto &node = numa_nodes[chunk.numa_node];
+	lock_guard<mutex> guard(node.lock);
+	node.free_blocks.push_back(pointer);
+	D_ASSERT(chunk.used_blocks > 0);
+	chunk.used_blocks--;
+#ifdef DUCKDB_HUGE_PAGE_ALLOCATION
+	if (chunk.used_blocks == 0 && node.free_blocks.size() > FREE_BLOCK_CACHE_SIZE) {
+		// return the memory of the chunk to the OS - the chunk stays bound to the NUMA node when it is reused
+		madvise(arena + chunk_idx * CHUNK_SIZE, CHUNK_SIZE, MADV_DONTNEED);
+	}
+#endif
+}
+
+data_ptr_t BlockAllocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t new_size) {
+	if (old_size == new_size) {
+		return pointer;
+	}
+	auto allocate_from_arena = new_size == Storage::BLOCK_ALLOC_SIZE && enabled;
+	if (!aligned_allocation && !allocate_from_arena && !IsArenaPointer(pointer) && !IsAlignedPointer(pointer, false)) {
+		return GetDatabaseAllocator().ReallocateData(pointer, old_size, new_size);
+	}
+	// there is no aligned reallocation: allocate a new buffer and copy the data
+	auto new_pointer = AllocateData(new_size);
+	if (!new_pointer) {
+		return nullptr;
+	}
+	memcpy(new_pointer, pointer, MinValue(old_size, new_size));
+	FreeData(pointer, old_size);
+	return new_pointer;
+}
+
+data_ptr_t BlockAllocator::BlockAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size) {
+	return private_data->Cast<BlockAllocatorData>().block_allocator.AllocateData(size);
+}
+
+void BlockAllocator::BlockAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+	private_data->Cast<BlockAllocatorData>().block_allocator.FreeData(pointer, size);
+}
+
+data_ptr_t BlockAllocator::BlockAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer,
+                                                 idx_t old_size, idx_t size) {
+	return private_data->Cast<BlockAllocatorData>().block_allocator.ReallocateData(pointer, old_size, size);
+}
+
+} // namespace duckdb
@@ -10,7 +10,8 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_timestamp(0),
-      can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
+      eviction_queue_idx(DConstants::INVALID_INDEX), probation_eviction_time(0), can_destroy(false),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_timestamp = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
@@ -20,8 +21,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_timestamp(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+      eviction_queue_idx(DConstants::INVALID_INDEX), probation_eviction_time(0), can_destroy(can_destroy_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -34,7 +35,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes();
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
@@ -93,6 +94,19 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	return BufferHandle(handle, handle->buffer.get());
 }
 
+unique_ptr<Block> BlockHandle::AllocateLoadBuffer(BlockHandle &handle, unique_ptr<FileBuffer> reusable_buffer) {
+	D_ASSERT(handle.block_id < MAXIMUM_BLOCK);
+	return AllocateBlock(handle.block_manager, std::move(reusable_buffer), handle.block_id);
+}
+
+BufferHandle BlockHandle::LoadFromBlock(shared_ptr<BlockHandle> &handle, unique_ptr<Block> block) {
+	D_ASSERT(handle->state != BlockState::BLOCK_LOADED);
+	D_ASSERT(block->id == handle->block_id);
+	handle->buffer = std::move(block);
+	handle->state = BlockState::BLOCK_LOADED;
+	return BufferHandle(handle, handle->buffer.get());
+}
+
 unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	if (state == BlockState::BLOCK_UNLOADED) {
 		// already unloaded: nothing to do
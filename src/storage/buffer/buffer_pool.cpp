@@ -1,158 +1,218 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
-struct EvictionQueue {
-	eviction_queue_t q;
-};
+//! Threads that run on the same group of cores share a shard of the eviction queues and a memory usage cache
+static constexpr idx_t CORES_PER_GROUP = 8;
 
-bool BufferEvictionNode::CanUnload(BlockHandle &handle_p) {
-	if (timestamp != handle_p.eviction_timestamp) {
-		// handle was used in between
-		return false;
-	}
-	return handle_p.CanUnload();
+static idx_t GetCoreGroupCount() {
+	idx_t cores = std::thread::hardware_concurrency();
+	return MinValue<idx_t>(MaxValue<idx_t>(cores / CORES_PER_GROUP, 1), BufferPool::MemoryUsage::MAX_CACHE_COUNT);
 }
 
-shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
-	auto handle_p = handle.lock();
-	if (!handle_p) {
-		// BlockHandle has been destroyed
-		return nullptr;
+static idx_t GetCoreGroup(idx_t group_count) {
+	if (group_count == 1) {
+		return 0;
 	}
-	if (!CanUnload(*handle_p)) {
-		// handle was used in between
-		return nullptr;
-	}
-	// this is the latest node in the queue with this handle
-	return handle_p;
+	return TaskScheduler::GetEstimatedCPUId() / CORES_PER_GROUP % group_count;
 }
 
-BufferPool::BufferPool(idx_t maximum_memory)
-    : current_memory(0), maximum_memory(maximum_memory), queue(make_uniq<EvictionQueue>()),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0), total_dead_nodes(0) {
-	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
-		memory_usage_per_tag[i] = 0;
+//! A shard of an eviction queue, threads add their nodes to the shard of their core group
+struct EvictionQueueShard {
+	EvictionQueueShard() : evict_queue_insertions(0), dead_nodes(0) {
 	}
-}
-BufferPool::~BufferPool() {
-}
-
-bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-
-	// The block handle is locked during this operation (Unpin),
-	// or the block handle is still a local variable (ConvertToPersistent)
-
-	D_ASSERT(handle->readers == 0);
-	auto ts = ++handle->eviction_timestamp;
 
-	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
+	//! The concurrent queue
+	eviction_queue_t q;
+	//! Number of insertions into this shard. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! The dead nodes counted by the threads of this core group. As nodes can die on any thread, only the sum
+	//! over all shards is meaningful (the individual counters may wrap around).
+	atomic<idx_t> dead_nodes;
+	//! Locked, if a purge of this shard is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
+};
 
-	if (ts != 1) {
-		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+struct EvictionQueue {
+public:
+	explicit EvictionQueue(idx_t shard_count) : dequeue_shard(0), has_peeked_node(false) {
+		for (idx_t i = 0; i < shard_count; i++) {
+			shards.push_back(make_uniq<EvictionQueueShard>());
+		}
 	}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
-		return true;
+public:
+	//! Add a node to the queue. Returns true, if the queue is ready to be purged, and false otherwise.
+	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Tries to dequeue the peeked node, or else an element from any of the shards
+	bool TryDequeue(BufferEvictionNode &node);
+	//! Tries to get the insertion time of the oldest node, the node is dequeued and kept until the next TryDequeue
+	bool TryPeek(idx_t &insertion_time);
+	//! The approximate number of nodes that are still alive
+	idx_t GetApproximateAliveNodes() const;
+	//! Garbage collect dead nodes in the shards of the eviction queue.
+	void Purge();
+	//! Increment the dead node counter in the purge queue.
+	inline void IncrementDeadNodes() {
+		GetLocalShard().dead_nodes++;
+	}
+	//! Decrement the dead node counter in the purge queue.
+	inline void DecrementDeadNodes() {
+		GetLocalShard().dead_nodes--;
 	}
-	return false;
-}
 
-void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
-	if (size < 0) {
-		current_memory -= UnsafeNumericCast<idx_t>(-size);
-		memory_usage_per_tag[uint8_t(tag)] -= UnsafeNumericCast<idx_t>(-size);
-	} else {
-		current_memory += UnsafeNumericCast<idx_t>(size);
-		memory_usage_per_tag[uint8_t(tag)] += UnsafeNumericCast<idx_t>(size);
+private:
+	EvictionQueueShard &GetLocalShard() {
+		return *shards[GetCoreGroup(shards.size())];
 	}
-}
+	//! Tries to dequeue an element from any of the shards, starting at a different shard every time so all shards
+	//! are evicted from evenly.
+	bool TryDequeueFromShards(BufferEvictionNode &node);
+	//! Tries to dequeue an element from a shard, but only after acquiring the purge queue lock of the shard.
+	bool TryDequeueWithLock(EvictionQueueShard &shard, BufferEvictionNode &node);
+	//! Bulk purge dead nodes from a shard. Then, enqueue those that are still alive.
+	void PurgeIteration(EvictionQueueShard &shard, const idx_t purge_size);
+	//! Garbage collect dead nodes in a shard.
+	void PurgeShard(EvictionQueueShard &shard);
+	//! The approximate number of dead nodes in all shards
+	idx_t GetDeadNodes() const;
+	//! The approximate number of nodes in all shards
+	idx_t GetApproximateSize() const;
+
+private:
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	constexpr static idx_t INSERT_INTERVAL = 4096;
+	//! We multiply the base purge size by this value.
+	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
+	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
+	//! We never purge below this point.
+	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
+	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
+	//! exceed their allowed ratio. Must be greater than 1.
+	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+
+	//! The shards, one per core group
+	vector<unique_ptr<EvictionQueueShard>> shards;
+	//! The shard at which the next dequeue starts
+	atomic<idx_t> dequeue_shard;
+	//! The node that was dequeued by TryPeek, it is returned by the next TryDequeue
+	mutex peek_lock;
+	BufferEvictionNode peeked_node;
+	atomic<bool> has_peeked_node;
+};
 
-idx_t BufferPool::GetUsedMemory() const {
-	return current_memory;
-}
+//! The index of the LRU queue, followed by the probationary and protected queues of every memory tag
+static constexpr idx_t LRU_QUEUE_IDX = 0;
+static constexpr idx_t EVICTION_QUEUE_COUNT = 1 + 2 * MEMORY_TAG_COUNT;
 
-idx_t BufferPool::GetMaxMemory() const {
-	return maximum_memory;
+static idx_t ProbationQueueIndex(MemoryTag tag) {
+	return 1 + 2 * idx_t(tag);
 }
 
-idx_t BufferPool::GetQueryMaxMemory() const {
-	return GetMaxMemory();
+static idx_t ProtectedQueueIndex(MemoryTag tag) {
+	return 2 + 2 * idx_t(tag);
 }
 
-TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
-	return *temporary_memory_manager;
-}
+//! The protected blocks may take up this percentage of the memory limit, beyond it they are evicted first
+static constexpr idx_t PROTECTED_MEMORY_PERCENTAGE = 75;
 
-BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
-                                                   unique_ptr<FileBuffer> *buffer) {
-	BufferEvictionNode node;
-	TempBufferPoolReservation r(tag, *this, extra_memory);
+bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+	auto &shard = GetLocalShard();
+	shard.q.enqueue(std::move(node));
+	return ++shard.evict_queue_insertions % INSERT_INTERVAL == 0;
+}
 
-	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
-			// we could not dequeue any eviction node, so we try one more time,
-			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
-				// still no success, we return
-				r.Resize(0);
-				return {false, std::move(r)};
-			}
+bool EvictionQueue::TryDequeue(BufferEvictionNode &node) {
+	if (has_peeked_node) {
+		lock_guard<mutex> lock(peek_lock);
+		if (has_peeked_node) {
+			node = std::move(peeked_node);
+			has_peeked_node = false;
+			return true;
 		}
+	}
+	return TryDequeueFromShards(node);
+}
 
-		// get a reference to the underlying block pointer
-		auto handle = node.TryGetBlockHandle();
-		if (!handle) {
-			DecrementDeadNodes();
-			continue;
+bool EvictionQueue::TryPeek(idx_t &insertion_time) {
+	lock_guard<mutex> lock(peek_lock);
+	if (!has_peeked_node) {
+		if (!TryDequeueFromShards(peeked_node)) {
+			return false;
 		}
+		has_peeked_node = true;
+	}
+	insertion_time = peeked_node.insertion_time;
+	return true;
+}
 
-		// we might be able to free this block: grab the mutex and check if we can free it
-		lock_guard<mutex> lock(handle->lock);
-		if (!node.CanUnload(*handle)) {
-			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
-			continue;
+bool EvictionQueue::TryDequeueFromShards(BufferEvictionNode &node) {
+	auto shard_count = shards.size();
+	auto start = shard_count == 1 ? 0 : dequeue_shard++;
+	for (idx_t i = 0; i < shard_count; i++) {
+		auto &shard = *shards[(start + i) % shard_count];
+		if (shard.q.try_dequeue(node)) {
+			return true;
 		}
-
-		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
-			// we can re-use the memory directly
-			*buffer = handle->UnloadAndTakeBlock();
-			return {true, std::move(r)};
+		// we could not dequeue any eviction node, so we try one more time,
+		// but more aggressively
+		if (TryDequeueWithLock(shard, node)) {
+			return true;
 		}
+	}
+	return false;
+}
 
-		// release the memory and mark the block as unloaded
-		handle->Unload();
+bool EvictionQueue::TryDequeueWithLock(EvictionQueueShard &shard, BufferEvictionNode &node) {
+	lock_guard<mutex> lock(shard.purge_lock);
+	return shard.q.try_dequeue(node);
+}
+
+idx_t EvictionQueue::GetDeadNodes() const {
+	idx_t dead_nodes = 0;
+	for (auto &shard : shards) {
+		dead_nodes += shard->dead_nodes;
 	}
-	return {true, std::move(r)};
+	return dead_nodes;
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
-	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+idx_t EvictionQueue::GetApproximateSize() const {
+	idx_t size = has_peeked_node ? 1 : 0;
+	for (auto &shard : shards) {
+		size += shard->q.size_approx();
+	}
+	return size;
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+idx_t EvictionQueue::GetApproximateAliveNodes() const {
+	auto size = GetApproximateSize();
+	auto dead_nodes = GetDeadNodes();
+	return dead_nodes > size ? 0 : size - dead_nodes;
+}
+
+void EvictionQueue::PurgeIteration(EvictionQueueShard &shard, const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
+	auto &purge_nodes = shard.purge_nodes;
 	idx_t previous_purge_size = purge_nodes.size();
 	if (purge_size < previous_purge_size / 2 || purge_size > previous_purge_size) {
 		purge_nodes.resize(purge_size);
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = shard.q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -160,29 +220,35 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			shard.q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
 
-	total_dead_nodes -= actually_dequeued - alive_nodes;
+	shard.dead_nodes -= actually_dequeued - alive_nodes;
 }
 
-void BufferPool::PurgeQueue() {
+void EvictionQueue::Purge() {
+	for (auto &shard : shards) {
+		PurgeShard(*shard);
+	}
+}
+
+void EvictionQueue::PurgeShard(EvictionQueueShard &shard) {
 
-	// only one thread purges the queue, all other threads early-out
-	if (!purge_lock.try_lock()) {
+	// only one thread purges the shard, all other threads early-out
+	if (!shard.purge_lock.try_lock()) {
 		return;
 	}
-	lock_guard<mutex> lock {purge_lock, std::adopt_lock};
+	lock_guard<mutex> lock {shard.purge_lock, std::adopt_lock};
 
 	// we purge INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER nodes
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
-	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	// get an estimate of the shard size as-of now
+	idx_t approx_q_size = shard.q.size_approx();
 
-	// early-out, if the queue is not big enough to justify purging
+	// early-out, if the shard is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
 	if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 		return;
@@ -198,28 +264,30 @@ void BufferPool::PurgeQueue() {
 	// i.e., we actively seek a specific number of dead nodes to purge. We use the total number of existing dead nodes.
 	// We detect this situation by observing the queue's ratio between alive vs. dead nodes. If the ratio of alive vs.
 	// dead nodes grows faster than we can purge, we keep purging until we hit one of the following conditions.
+	// As dead nodes are not counted per shard, we use the ratio of the entire queue.
 
-	// 2.1. We're back at an approximate queue size less than purge_size * EARLY_OUT_MULTIPLIER.
+	// 2.1. We're back at an approximate shard size less than purge_size * EARLY_OUT_MULTIPLIER.
 	// 2.2. We're back at a ratio of 1*alive_node:ALIVE_NODE_MULTIPLIER*dead_nodes.
-	// 2.3. We've purged the entire queue: max_purges is zero. This is a worst-case scenario,
+	// 2.3. We've purged the entire shard: max_purges is zero. This is a worst-case scenario,
 	// guaranteeing that we always exit the loop.
 
 	idx_t max_purges = approx_q_size / purge_size;
 	while (max_purges != 0) {
 
-		PurgeIteration(purge_size);
+		PurgeIteration(shard, purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = shard.q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 			break;
 		}
 
-		idx_t approx_dead_nodes = total_dead_nodes;
-		approx_dead_nodes = approx_dead_nodes > approx_q_size ? approx_q_size : approx_dead_nodes;
-		idx_t approx_alive_nodes = approx_q_size - approx_dead_nodes;
+		idx_t approx_total_size = GetApproximateSize();
+		idx_t approx_dead_nodes = GetDeadNodes();
+		approx_dead_nodes = approx_dead_nodes > approx_total_size ? approx_total_size : approx_dead_nodes;
+		idx_t approx_alive_nodes = approx_total_size - approx_dead_nodes;
 
 		// early-out according to (2.2)
 		if (approx_alive_nodes * (ALIVE_NODE_MULTIPLIER - 1) > approx_dead_nodes) {
@@ -230,6 +298,289 @@ void BufferPool::PurgeQueue() {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Memory Usage
+//===--------------------------------------------------------------------===//
+BufferPool::MemoryUsage::MemoryUsage(idx_t cache_count) : cache_count(cache_count) {
+	D_ASSERT(cache_count >= 1 && cache_count <= MAX_CACHE_COUNT);
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		memory_usage.counters[i] = 0;
+		for (auto &cache : caches) {
+			cache.counters[i] = 0;
+		}
+	}
+}
+
+idx_t BufferPool::MemoryUsage::GetUsedMemory(idx_t index, bool include_caches) const {
+	int64_t used_memory = memory_usage.counters[index];
+	if (include_caches) {
+		for (idx_t i = 0; i < cache_count; i++) {
+			used_memory += caches[i].counters[index];
+		}
+	}
+	// memory can be freed on a different core group than it was allocated on: the sum can briefly be negative
+	return used_memory < 0 ? 0 : UnsafeNumericCast<idx_t>(used_memory);
+}
+
+void BufferPool::MemoryUsage::UpdateUsedMemory(MemoryTag tag, int64_t size) {
+	auto tag_idx = idx_t(tag);
+	if (cache_count == 1 || size >= CACHE_THRESHOLD || size <= -CACHE_THRESHOLD) {
+		// large updates are applied to the shared counters directly
+		memory_usage.counters[tag_idx] += size;
+		memory_usage.counters[TOTAL_MEMORY_USAGE_INDEX] += size;
+		return;
+	}
+	// small updates are batched in the cache of the core group
+	auto &cache = caches[GetCoreGroup(cache_count)];
+	UpdateUsedMemory(cache, tag_idx, size);
+	UpdateUsedMemory(cache, TOTAL_MEMORY_USAGE_INDEX, size);
+}
+
+void BufferPool::MemoryUsage::UpdateUsedMemory(Counters &cache, idx_t index, int64_t size) {
+	auto cached = cache.counters[index] += size;
+	if (cached >= CACHE_THRESHOLD || cached <= -CACHE_THRESHOLD) {
+		// the cache has grown too large: move its contents to the shared counter
+		memory_usage.counters[index] += cache.counters[index].exchange(0);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Pool
+//===--------------------------------------------------------------------===//
+bool BufferEvictionNode::CanUnload(BlockHandle &handle_p) {
+	if (timestamp != handle_p.eviction_timestamp) {
+		// handle was used in between
+		return false;
+	}
+	return handle_p.CanUnload();
+}
+
+shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
+	auto handle_p = handle.lock();
+	if (!handle_p) {
+		// BlockHandle has been destroyed
+		return nullptr;
+	}
+	if (!CanUnload(*handle_p)) {
+		// handle was used in between
+		return nullptr;
+	}
+	// this is the latest node in the queue with this handle
+	return handle_p;
+}
+
+BufferPool::BufferPool(idx_t maximum_memory)
+    : memory_usage(GetCoreGroupCount()), maximum_memory(maximum_memory),
+      eviction_policy(BufferEvictionPolicy::LRU), probation_evictions(0), queue_insertions(0),
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), block_allocator(make_uniq<BlockAllocator>()) {
+	auto shard_count = GetCoreGroupCount();
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		queues.push_back(make_uniq<EvictionQueue>(shard_count));
+	}
+}
+BufferPool::~BufferPool() {
+}
+
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	// blocks that are already in a queue stay there until they are unpinned again
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+BlockAllocator &BufferPool::GetBlockAllocator() {
+	return *block_allocator;
+}
+
+bool BufferPool::IsProbationQueue(idx_t queue_idx) {
+	return queue_idx != LRU_QUEUE_IDX && queue_idx % 2 == 1;
+}
+
+idx_t BufferPool::GetEvictionQueueIndex(BlockHandle &handle) const {
+	if (eviction_policy == BufferEvictionPolicy::LRU) {
+		return LRU_QUEUE_IDX;
+	}
+	auto protected_idx = ProtectedQueueIndex(handle.tag);
+	if (handle.eviction_queue_idx == protected_idx) {
+		// the block is protected until it is evicted
+		return protected_idx;
+	}
+	if (handle.probation_eviction_time != 0) {
+		// the block was evicted from a probationary queue before - it is protected if it was re-loaded shortly after
+		// i.e., if fewer blocks than half of the memory limit have been evicted from the probationary queues since
+		idx_t evictions_since = probation_evictions - handle.probation_eviction_time;
+		if (evictions_since < maximum_memory / Storage::BLOCK_ALLOC_SIZE / 2) {
+			return protected_idx;
+		}
+	}
+	return ProbationQueueIndex(handle.tag);
+}
+
+idx_t BufferPool::GetOldestEvictionQueue(bool probation) {
+	idx_t result = DConstants::INVALID_INDEX;
+	idx_t oldest_time = 0;
+	for (idx_t tag_idx = 0; tag_idx < MEMORY_TAG_COUNT; tag_idx++) {
+		auto tag = MemoryTag(tag_idx);
+		auto queue_idx = probation ? ProbationQueueIndex(tag) : ProtectedQueueIndex(tag);
+		idx_t insertion_time;
+		if (!queues[queue_idx]->TryPeek(insertion_time)) {
+			continue;
+		}
+		if (result == DConstants::INVALID_INDEX || insertion_time < oldest_time) {
+			result = queue_idx;
+			oldest_time = insertion_time;
+		}
+	}
+	return result;
+}
+
+idx_t BufferPool::GetProtectedBlockCount() const {
+	idx_t count = 0;
+	for (idx_t tag_idx = 0; tag_idx < MEMORY_TAG_COUNT; tag_idx++) {
+		count += queues[ProtectedQueueIndex(MemoryTag(tag_idx))]->GetApproximateAliveNodes();
+	}
+	return count;
+}
+
+bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
+
+	// The block handle is locked during this operation (Unpin),
+	// or the block handle is still a local variable (ConvertToPersistent)
+
+	D_ASSERT(handle->readers == 0);
+	auto ts = ++handle->eviction_timestamp;
+
+	if (handle->eviction_queue_idx != DConstants::INVALID_INDEX) {
+		// we add a newer version, i.e., we kill exactly one previous version
+		D_ASSERT(ts != 1);
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
+	}
+
+	auto queue_idx = GetEvictionQueueIndex(*handle);
+	handle->eviction_queue_idx = queue_idx;
+
+	// only the nodes of the 2Q queues are compared by age
+	auto insertion_time = queue_idx == LRU_QUEUE_IDX ? 0 : queue_insertions.fetch_add(1, std::memory_order_relaxed);
+	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts, insertion_time);
+	return queues[queue_idx]->AddToEvictionQueue(std::move(evict_node));
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	if (handle.eviction_queue_idx == DConstants::INVALID_INDEX) {
+		return;
+	}
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
+	memory_usage.UpdateUsedMemory(tag, size);
+}
+
+idx_t BufferPool::GetUsedMemory() const {
+	return memory_usage.GetUsedMemory(MemoryUsage::TOTAL_MEMORY_USAGE_INDEX, true);
+}
+
+idx_t BufferPool::GetUsedMemory(MemoryTag tag) const {
+	return memory_usage.GetUsedMemory(idx_t(tag), true);
+}
+
+idx_t BufferPool::GetMaxMemory() const {
+	return maximum_memory;
+}
+
+idx_t BufferPool::GetQueryMaxMemory() const {
+	return GetMaxMemory();
+}
+
+TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
+	return *temporary_memory_manager;
+}
+
+BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
+                                                   unique_ptr<FileBuffer> *buffer) {
+	BufferEvictionNode node;
+	TempBufferPoolReservation r(tag, *this, extra_memory);
+
+	// we evict from the LRU queue first, then from the probationary queues, and finally from the protected queues
+	// if the protected blocks take up more than their share of the memory limit, they are evicted before the
+	// probationary blocks, so a large hot set cannot starve the probationary queues
+	// note that we do not include the memory usage in the caches of the core groups here (for performance reasons)
+	// this is at most CACHE_THRESHOLD per core group
+	bool lru_queue_empty = false;
+	idx_t protected_block_count = 0;
+	auto protected_block_limit = maximum_memory / Storage::BLOCK_ALLOC_SIZE * PROTECTED_MEMORY_PERCENTAGE / 100;
+	while (memory_usage.GetUsedMemory(MemoryUsage::TOTAL_MEMORY_USAGE_INDEX, false) > memory_limit) {
+		idx_t queue_idx = LRU_QUEUE_IDX;
+		if (lru_queue_empty) {
+			// pick the oldest block of the probationary or the protected queues
+			bool evict_protected = protected_block_count > protected_block_limit;
+			queue_idx = GetOldestEvictionQueue(!evict_protected);
+			if (queue_idx == DConstants::INVALID_INDEX) {
+				queue_idx = GetOldestEvictionQueue(evict_protected);
+			}
+			if (queue_idx == DConstants::INVALID_INDEX) {
+				// we could not dequeue any eviction node from any of the queues, we return
+				r.Resize(0);
+				return {false, std::move(r)};
+			}
+		}
+		auto &queue = *queues[queue_idx];
+
+		// get a block to unpin from the queue
+		if (!queue.TryDequeue(node)) {
+			if (queue_idx == LRU_QUEUE_IDX) {
+				// no success, we move on to the 2Q queues
+				lru_queue_empty = true;
+				protected_block_count = GetProtectedBlockCount();
+			}
+			continue;
+		}
+
+		// get a reference to the underlying block pointer
+		auto handle = node.TryGetBlockHandle();
+		if (!handle) {
+			queue.DecrementDeadNodes();
+			continue;
+		}
+
+		// we might be able to free this block: grab the mutex and check if we can free it
+		lock_guard<mutex> lock(handle->lock);
+		if (!node.CanUnload(*handle)) {
+			// something changed in the mean-time, bail out
+			queue.DecrementDeadNodes();
+			continue;
+		}
+
+		// the block no longer has a node in any of the queues
+		handle->eviction_queue_idx = DConstants::INVALID_INDEX;
+		if (IsProbationQueue(queue_idx)) {
+			// remember when the block was evicted, so we can protect it if it is re-loaded shortly after
+			handle->probation_eviction_time = ++probation_evictions;
+		} else if (queue_idx != LRU_QUEUE_IDX && protected_block_count > 0) {
+			protected_block_count--;
+		}
+
+		// hooray, we can unload the block
+		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+			// we can re-use the memory directly
+			*buffer = handle->UnloadAndTakeBlock();
+			return {true, std::move(r)};
+		}
+
+		// release the memory and mark the block as unloaded
+		handle->Unload();
+	}
+	return {true, std::move(r)};
+}
+
+void BufferPool::PurgeQueue() {
+	for (auto &queue : queues) {
+		queue->Purge();
+	}
+}
+
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	lock_guard<mutex> l_lock(limit_lock);
 	// try to evict until the limit is reached
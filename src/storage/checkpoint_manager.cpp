@@ -35,8 +35,9 @@ namespace duckdb {
 
 void ReorderTableEntries(catalog_entry_vector_t &tables);
 
-SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager)
-    : CheckpointWriter(db), partial_block_manager(block_manager, CheckpointType::FULL_CHECKPOINT) {
+SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager,
+                                                       bool concurrent_reads)
+    : CheckpointWriter(db, concurrent_reads), partial_block_manager(block_manager, CheckpointType::FULL_CHECKPOINT) {
 }
 
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
@@ -539,6 +540,11 @@ void CheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer &serializ
 
 	// Write the table data
 	if (auto writer = GetTableDataWriter(table)) {
+		unique_ptr<StorageLockKey> lock;
+		if (concurrent_reads) {
+			// wait for the scans of the table to finish, and block new scans while its data is rewritten
+			lock = table.GetStorage().info->checkpoint_lock.GetExclusiveLock();
+		}
 		writer->WriteTableData(serializer);
 	}
 }
@@ -104,6 +104,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -432,6 +434,12 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	idx_t dictionary_size = 0;
+	//! The identifier of the dictionary, used to recognize vectors that share the same dictionary
+	idx_t dictionary_id = 0;
+	//! The filter that was evaluated on the dictionary, and whether or not every dictionary entry passes it
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_result;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -451,6 +459,8 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
+	state->dictionary_id = DictionaryVector::GenerateDictionaryId();
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -474,12 +484,6 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto start = segment.GetRelativeIndex(state.row_index);
 
 	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
-	auto dict = DictionaryCompressionStorage::GetDictionary(segment, scan_state.handle);
-
-	auto header_ptr = reinterpret_cast<dictionary_compression_header_t *>(baseptr);
-	auto index_buffer_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->index_buffer_offset));
-	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
-
 	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
 	auto result_data = FlatVector::GetData<string_t>(result);
 
@@ -505,13 +509,11 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 		BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(sel_vec_ptr), src, decompress_count,
 		                                          scan_state.current_width);
 
+		// the strings of the dictionary have already been decoded when initializing the scan
+		auto dictionary_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
 		for (idx_t i = 0; i < scan_count; i++) {
-			// Lookup dict offset in index buffer
 			auto string_number = scan_state.sel_vec->get_index(i + start_offset);
-			auto dict_offset = index_buffer_ptr[string_number];
-			auto str_len = GetStringLength(index_buffer_ptr, UnsafeNumericCast<sel_t>(string_number));
-			result_data[result_offset + i] =
-			    FetchStringFromDict(segment, dict, baseptr, UnsafeNumericCast<int32_t>(dict_offset), str_len);
+			result_data[result_offset + i] = dictionary_data[string_number];
 		}
 
 	} else {
@@ -533,7 +535,8 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, *scan_state.sel_vec, scan_count);
+		DictionaryVector::SetDictionaryId(result, scan_state.dictionary_id);
 	}
 }
 
@@ -542,6 +545,69 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter base data
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every string in the dictionary
+		auto &dictionary = *scan_state.dictionary;
+		auto dictionary_size = scan_state.dictionary_size;
+		UnifiedVectorFormat vdata;
+		dictionary.ToUnifiedFormat(dictionary_size, vdata);
+		SelectionVector dictionary_sel;
+		idx_t approved_count = dictionary_size;
+		ColumnSegment::FilterSelection(dictionary_sel, dictionary, vdata, filter, dictionary_size, approved_count);
+
+		scan_state.filter_result = make_unsafe_uniq_array<bool>(dictionary_size);
+		memset(scan_state.filter_result.get(), 0, sizeof(bool) * dictionary_size);
+		for (idx_t i = 0; i < approved_count; i++) {
+			scan_state.filter_result[dictionary_sel.get_index(i)] = true;
+		}
+		scan_state.filter = &filter;
+	}
+
+	// decompress the dictionary indices of this vector
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	sel_t *sel_vec_ptr = scan_state.sel_vec->data();
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(sel_vec_ptr), src, decompress_count,
+	                                          scan_state.current_width);
+	auto indices = sel_vec_ptr + start_offset;
+
+	// look up the strings from the already decompressed dictionary
+	auto dictionary_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	for (idx_t i = 0; i < scan_count; i++) {
+		result_data[i] = dictionary_data[indices[i]];
+	}
+
+	// narrow down the selection using the filter result of the dictionary
+	SelectionVector new_sel(sel_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		if (scan_state.filter_result[indices[idx]]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	sel_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -638,13 +704,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	CompressionFunction result(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	result.filter = DictionaryCompressionStorage::StringFilter;
+	return result;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -75,6 +75,24 @@ void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t
 	result.SetVectorType(VectorType::CONSTANT_VECTOR);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantFilterFunction(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                            SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	// every row in the segment has the same value: evaluate the filter only once
+	ConstantScanFunction<T>(segment, state, scan_count, result);
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(1, vdata);
+	SelectionVector constant_sel;
+	idx_t approved_count = 1;
+	ColumnSegment::FilterSelection(constant_sel, result, vdata, filter, 1, approved_count);
+	if (approved_count == 0) {
+		sel_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -100,9 +118,11 @@ CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	CompressionFunction result(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
 	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
 	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	result.filter = ConstantFilterFunction<T>;
+	return result;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
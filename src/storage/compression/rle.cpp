@@ -372,6 +372,67 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// gather the values of the runs that overlap with this vector
+	Vector run_values(result.GetType(), scan_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	idx_t run_ends[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	idx_t entry_pos = scan_state.entry_pos;
+	idx_t run_end = index_pointer[entry_pos] - scan_state.position_in_entry;
+	while (true) {
+		run_data[run_count] = data_pointer[entry_pos];
+		run_ends[run_count] = MinValue<idx_t>(run_end, scan_count);
+		run_count++;
+		if (run_end >= scan_count) {
+			break;
+		}
+		entry_pos++;
+		run_end += index_pointer[entry_pos];
+	}
+
+	// evaluate the filter once per run instead of once per row
+	UnifiedVectorFormat vdata;
+	run_values.ToUnifiedFormat(run_count, vdata);
+	SelectionVector run_sel;
+	idx_t approved_runs = run_count;
+	ColumnSegment::FilterSelection(run_sel, run_values, vdata, filter, run_count, approved_runs);
+
+	RLEScan<T>(segment, state, scan_count, result);
+	if (approved_runs == run_count || sel_count == 0) {
+		// every run passes the filter
+		return;
+	}
+	bool row_passes[STANDARD_VECTOR_SIZE];
+	memset(row_passes, 0, sizeof(bool) * scan_count);
+	for (idx_t i = 0; i < approved_runs; i++) {
+		auto run_idx = run_sel.get_index(i);
+		auto run_start = run_idx == 0 ? 0 : run_ends[run_idx - 1];
+		memset(row_passes + run_start, 1, sizeof(bool) * (run_ends[run_idx] - run_start));
+	}
+	SelectionVector new_sel(sel_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		if (row_passes[idx]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	sel_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -391,10 +452,12 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	CompressionFunction result(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
 	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
 	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
 	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	result.filter = RLEFilter<T>;
+	return result;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -4,9 +4,11 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -145,7 +147,7 @@ T DeserializeHeaderStructure(data_ptr_t ptr) {
 
 SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path_p, StorageManagerOptions options)
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(std::move(path_p)),
-      header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
+      header_buffer(BlockAllocator::Get(db.GetDatabase()), FileBufferType::MANAGED_BUFFER,
                     Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
       iteration_count(0), options(options) {
 }
@@ -164,6 +166,9 @@ FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	if (options.use_direct_io) {
 		result |= FileFlags::FILE_FLAGS_DIRECT_IO;
 	}
+	if (options.use_io_uring) {
+		result |= FileFlags::FILE_FLAGS_IO_URING;
+	}
 	// database files can be read from in parallel
 	result |= FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
 	return result;
@@ -404,7 +409,7 @@ unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileB
 	if (source_buffer) {
 		result = ConvertBlock(block_id, *source_buffer);
 	} else {
-		result = make_uniq<Block>(Allocator::Get(db), block_id);
+		result = make_uniq<Block>(BlockAllocator::Get(db.GetDatabase()), block_id);
 	}
 	result->Initialize(options.debug_initialize);
 	return result;
@@ -416,6 +421,34 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, BLOCK_START + NumericCast<idx_t>(block.id) * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::ReadBlocks(const vector<reference<Block>> &blocks) {
+	// submit the reads of all blocks together, so they can be executed concurrently
+	vector<FileReadRequest> requests;
+	requests.reserve(blocks.size());
+	for (auto &block_ref : blocks) {
+		auto &block = block_ref.get();
+		D_ASSERT(block.id >= 0);
+		FileReadRequest request;
+		request.buffer = block.InternalBuffer();
+		request.nr_bytes = block.AllocSize();
+		request.location = BLOCK_START + NumericCast<idx_t>(block.id) * Storage::BLOCK_ALLOC_SIZE;
+		requests.push_back(request);
+	}
+	handle->ReadBatch(requests.data(), requests.size());
+
+	// verify the checksums of all blocks
+	for (auto &block_ref : blocks) {
+		auto &block = block_ref.get();
+		auto stored_checksum = Load<uint64_t>(block.InternalBuffer());
+		uint64_t computed_checksum = Checksum(block.buffer, block.size);
+		if (stored_checksum != computed_checksum) {
+			throw IOException(
+			    "Corrupt database file: computed checksum %llu does not match stored checksum %llu in block %llu",
+			    computed_checksum, stored_checksum, block.id);
+		}
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + NumericCast<idx_t>(block_id) * Storage::BLOCK_ALLOC_SIZE);
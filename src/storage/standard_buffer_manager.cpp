@@ -35,7 +35,7 @@ unique_ptr<FileBuffer> StandardBufferManager::ConstructManagedBuffer(idx_t size,
 		result = make_uniq<FileBuffer>(*tmp, type);
 	} else {
 		// no re-usable buffer: allocate a new buffer
-		result = make_uniq<FileBuffer>(Allocator::Get(db), type, size);
+		result = make_uniq<FileBuffer>(BlockAllocator::Get(db), type, size);
 	}
 	result->Initialize(DBConfig::GetConfig(db).options.debug_initialize);
 	return result;
@@ -227,6 +227,86 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return buf;
 }
 
+void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	// figure out which of the blocks still have to be loaded, ordered by their location in the file
+	map<block_id_t, idx_t> to_be_loaded;
+	optional_ptr<BlockManager> block_manager;
+	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
+		auto &handle = handles[block_idx];
+		if (handle->block_id >= MAXIMUM_BLOCK) {
+			// only persistent blocks are prefetched
+			continue;
+		}
+		if (!block_manager) {
+			block_manager = &handle->block_manager;
+		} else if (block_manager.get() != &handle->block_manager) {
+			// the blocks are read from a single file
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state != BlockState::BLOCK_LOADED) {
+			to_be_loaded.insert(make_pair(handle->block_id, block_idx));
+		}
+	}
+	if (to_be_loaded.size() < 2) {
+		// a single block is read just as efficiently when it is pinned
+		return;
+	}
+	// only prefetch if the blocks comfortably fit in memory - prefetching should not evict the blocks it loads
+	auto required_memory = to_be_loaded.size() * Storage::BLOCK_ALLOC_SIZE;
+	if (GetUsedMemory() + 2 * required_memory > GetMaxMemory()) {
+		return;
+	}
+
+	// reserve the memory of the blocks in the buffer pool and allocate their buffers, so we can read into them directly
+	vector<idx_t> load_handles;
+	vector<unique_ptr<Block>> blocks;
+	vector<TempBufferPoolReservation> reservations;
+	for (auto &entry : to_be_loaded) {
+		auto &handle = handles[entry.second];
+		unique_ptr<FileBuffer> reusable_buffer;
+		auto eviction = buffer_pool.EvictBlocks(handle->tag, handle->memory_usage, buffer_pool.maximum_memory,
+		                                        &reusable_buffer);
+		if (!eviction.success) {
+			// not enough memory: the remaining blocks are loaded when they are pinned
+			break;
+		}
+		load_handles.push_back(entry.second);
+		blocks.push_back(BlockHandle::AllocateLoadBuffer(*handle, std::move(reusable_buffer)));
+		reservations.push_back(std::move(eviction.reservation));
+	}
+	if (blocks.empty()) {
+		return;
+	}
+
+	// submit the reads of all blocks as one batch
+	vector<reference<Block>> block_refs;
+	for (auto &block : blocks) {
+		block_refs.push_back(*block);
+	}
+	block_manager->ReadBlocks(block_refs);
+
+	// now load the blocks that were not loaded by another thread in the meantime
+	for (idx_t i = 0; i < blocks.size(); i++) {
+		auto &handle = handles[load_handles[i]];
+		// the block is not kept pinned: it is added to the eviction queue when "buf" goes out of scope
+		// prefetching relies on the block being pinned by the scan before it is evicted again
+		BufferHandle buf;
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				// the block was loaded by another thread in the meantime: its reservation is released
+				reservations[i].Resize(0);
+				continue;
+			}
+			buf = BlockHandle::LoadFromBlock(handle, std::move(blocks[i]));
+			D_ASSERT(handle->readers == 0);
+			handle->readers = 1;
+			handle->memory_charge = std::move(reservations[i]);
+		}
+	}
+}
+
 void StandardBufferManager::PurgeQueue() {
 	buffer_pool.PurgeQueue();
 }
@@ -237,7 +317,7 @@ void StandardBufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle)
 
 void StandardBufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
-	auto replacement_buffer = make_uniq<FileBuffer>(Allocator::Get(db), handle->buffer->type,
+	auto replacement_buffer = make_uniq<FileBuffer>(BlockAllocator::Get(db), handle->buffer->type,
 	                                                handle->memory_usage - Storage::BLOCK_HEADER_SIZE);
 	memcpy(replacement_buffer->buffer, handle->buffer->buffer, handle->buffer->size);
 	WriteGarbageIntoBuffer(*handle->buffer);
@@ -284,7 +364,7 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 	for (idx_t k = 0; k < MEMORY_TAG_COUNT; k++) {
 		MemoryInformation info;
 		info.tag = MemoryTag(k);
-		info.size = buffer_pool.memory_usage_per_tag[k].load();
+		info.size = buffer_pool.GetUsedMemory(MemoryTag(k));
 		info.evicted_data = evicted_data_per_tag[k].load();
 		result.push_back(info);
 	}
@@ -293,10 +373,17 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 
 unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBufferInternal(BufferManager &buffer_manager,
                                                                           FileHandle &handle, idx_t position,
-                                                                          idx_t size,
+                                                                          idx_t size, idx_t compressed_size,
                                                                           unique_ptr<FileBuffer> reusable_buffer) {
 	auto buffer = buffer_manager.ConstructManagedBuffer(size, std::move(reusable_buffer));
-	buffer->Read(handle, position);
+	if (compressed_size == 0) {
+		buffer->Read(handle, position);
+		return buffer;
+	}
+	// the buffer was compressed: read the compressed data and decompress it into the buffer
+	auto compressed_buffer = buffer_manager.GetBufferAllocator().Allocate(compressed_size);
+	handle.Read(compressed_buffer.get(), compressed_size, position);
+	TemporaryFileManager::DecompressBuffer(compressed_buffer.get(), compressed_size, *buffer);
 	return buffer;
 }
 
@@ -305,6 +392,13 @@ string StandardBufferManager::GetTemporaryPath(block_id_t id) {
 	return fs.JoinPath(temporary_directory.path, "duckdb_temp_block-" + to_string(id) + ".block");
 }
 
+FileOpenFlags StandardBufferManager::GetTemporaryFileFlags(FileOpenFlags flags) {
+	if (DBConfig::GetConfig(db).options.use_direct_io) {
+		flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+	}
+	return flags;
+}
+
 void StandardBufferManager::RequireTemporaryDirectory() {
 	if (temporary_directory.path.empty()) {
 		throw InvalidInputException(
@@ -330,11 +424,20 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	// get the path to write to
 	auto path = GetTemporaryPath(block_id);
 	D_ASSERT(buffer.size > Storage::BLOCK_SIZE);
-	// create the file and write the size followed by the buffer contents
+	// compress the buffer (if enabled)
+	AllocatedData compressed_buffer;
+	auto compressed_size = TemporaryFileManager::CompressBuffer(db, buffer, compressed_buffer);
+	// create the file and write the size and compressed size followed by the (compressed) buffer contents
 	auto &fs = FileSystem::GetFileSystem(db);
-	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+	auto open_flags = GetTemporaryFileFlags(FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+	auto handle = fs.OpenFile(path, open_flags);
 	handle->Write(&buffer.size, sizeof(idx_t), 0);
-	buffer.Write(*handle, sizeof(idx_t));
+	handle->Write(&compressed_size, sizeof(idx_t), sizeof(idx_t));
+	if (compressed_size == 0) {
+		buffer.Write(*handle, 2 * sizeof(idx_t));
+	} else {
+		handle->Write(compressed_buffer.get(), compressed_size, 2 * sizeof(idx_t));
+	}
 }
 
 unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag, block_id_t id,
@@ -346,15 +449,18 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 		return temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
 	}
 	idx_t block_size;
-	// open the temporary file and read the size
+	idx_t compressed_size;
+	// open the temporary file and read the size and compressed size
 	auto path = GetTemporaryPath(id);
 	auto &fs = FileSystem::GetFileSystem(db);
-	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto handle = fs.OpenFile(path, GetTemporaryFileFlags(FileFlags::FILE_FLAGS_READ));
 	handle->Read(&block_size, sizeof(idx_t), 0);
+	handle->Read(&compressed_size, sizeof(idx_t), sizeof(idx_t));
 	evicted_data_per_tag[uint8_t(tag)] -= block_size;
 
 	// now allocate a buffer of this size and read the data into that buffer
-	auto buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, std::move(reusable_buffer));
+	auto buffer = ReadTemporaryBufferInternal(*this, *handle, 2 * sizeof(idx_t), block_size, compressed_size,
+	                                          std::move(reusable_buffer));
 
 	handle.reset();
 	DeleteTemporaryFile(id);
@@ -442,7 +548,7 @@ void StandardBufferManager::FreeReservedMemory(idx_t size) {
 	if (size == 0) {
 		return;
 	}
-	buffer_pool.current_memory -= size;
+	buffer_pool.UpdateUsedMemory(MemoryTag::EXTENSION, -NumericCast<int64_t>(size));
 }
 
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,135 @@
+#include "duckdb/storage/statistics/bloom_filter.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(idx_t word_count) : words(MaxValue<idx_t>(word_count, 1), 0) {
+}
+
+unique_ptr<BloomFilter> BloomFilter::Create(vector<hash_t> &hashes) {
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+	auto result = make_uniq<BloomFilter>((hashes.size() * BITS_PER_VALUE + 63) / 64);
+	for (auto &hash : hashes) {
+		result->Insert(hash);
+	}
+	return result;
+}
+
+idx_t BloomFilter::GetWordIndex(hash_t hash) const {
+	// map the upper 32 bits of the hash onto [0, word_count) without a modulo
+	return ((hash >> 32) * words.size()) >> 32;
+}
+
+uint64_t BloomFilter::GetMask(hash_t hash) {
+	// the lower bits of the hash select four bits within the word
+	return (1ULL << (hash & 63)) | (1ULL << ((hash >> 6) & 63)) | (1ULL << ((hash >> 12) & 63)) |
+	       (1ULL << ((hash >> 18) & 63));
+}
+
+void BloomFilter::Insert(hash_t hash) {
+	words[GetWordIndex(hash)] |= GetMask(hash);
+}
+
+bool BloomFilter::MightContain(hash_t hash) const {
+	auto mask = GetMask(hash);
+	return (words[GetWordIndex(hash)] & mask) == mask;
+}
+
+bool BloomFilter::MightContain(const Value &value) const {
+	if (value.IsNull()) {
+		return false;
+	}
+	Vector input(value);
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, 1);
+	return MightContain(ConstantVector::GetData<hash_t>(hashes)[0]);
+}
+
+bool BloomFilter::MightContainAny(const vector<Value> &values) const {
+	if (values.empty()) {
+		return false;
+	}
+	Vector input(values[0].type());
+	Vector hashes(LogicalType::HASH);
+	for (idx_t offset = 0; offset < values.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(values.size() - offset, STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < count; i++) {
+			input.SetValue(i, values[offset + i]);
+		}
+		VectorOperations::Hash(input, hashes, count);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			if (!values[offset + i].IsNull() && MightContain(hash_data[i])) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool BloomFilter::TypeIsSupported(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+hash_t BloomFilter::GetHashCheck() {
+	static const hash_t HASH_CHECK = []() {
+		// hash a fixed set of values of the different hash paths (integers, floating points and strings)
+		// if any of these hashes changes, the filters written before the change cannot be used anymore
+		hash_t result = 0;
+		for (auto &value : {Value::BIGINT(42), Value::DOUBLE(0.5), Value("duckdb bloom filter")}) {
+			Vector input(value);
+			Vector hashes(LogicalType::HASH);
+			VectorOperations::Hash(input, hashes, 1);
+			result = CombineHash(result, ConstantVector::GetData<hash_t>(hashes)[0]);
+		}
+		return result;
+	}();
+	return HASH_CHECK;
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "word_count", words.size());
+	serializer.WriteProperty(101, "words", const_data_ptr_cast(words.data()), words.size() * sizeof(uint64_t));
+	serializer.WriteProperty<idx_t>(102, "hash_version", HASH_VERSION);
+	serializer.WriteProperty<hash_t>(103, "hash_check", GetHashCheck());
+}
+
+unique_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto word_count = deserializer.ReadProperty<idx_t>(100, "word_count");
+	auto result = make_uniq<BloomFilter>(word_count);
+	deserializer.ReadProperty(101, "words", data_ptr_cast(result->words.data()), word_count * sizeof(uint64_t));
+	auto hash_version = deserializer.ReadPropertyWithDefault<idx_t>(102, "hash_version", 0);
+	auto hash_check = deserializer.ReadPropertyWithDefault<hash_t>(103, "hash_check", 0);
+	if (hash_version != HASH_VERSION || hash_check != GetHashCheck()) {
+		// the filter was built with a different hash function: it would give false negatives, so we ignore it
+		return nullptr;
+	}
+	return result;
+}
+
+} // namespace duckdb
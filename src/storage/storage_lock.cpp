@@ -1,6 +1,7 @@
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/assert.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -22,6 +23,19 @@ StorageLock::StorageLock() : read_count(0) {
 unique_ptr<StorageLockKey> StorageLock::GetExclusiveLock() {
 	exclusive_lock.lock();
 	while (read_count != 0) {
+		// shared locks can be held for the duration of a scan: yield instead of spinning on the count
+		TaskScheduler::YieldThread();
+	}
+	return make_uniq<StorageLockKey>(*this, StorageLockType::EXCLUSIVE);
+}
+
+unique_ptr<StorageLockKey> StorageLock::TryGetExclusiveLock() {
+	if (!exclusive_lock.try_lock()) {
+		return nullptr;
+	}
+	if (read_count != 0) {
+		exclusive_lock.unlock();
+		return nullptr;
 	}
 	return make_uniq<StorageLockKey>(*this, StorageLockType::EXCLUSIVE);
 }
@@ -139,6 +139,7 @@ void SingleFileStorageManager::LoadDatabase(optional_ptr<ClientContext> context)
 	StorageManagerOptions options;
 	options.read_only = read_only;
 	options.use_direct_io = config.options.use_direct_io;
+	options.use_io_uring = config.options.enable_io_uring;
 	options.debug_initialize = config.options.debug_initialize;
 
 	// first check if the database exists
@@ -257,7 +258,7 @@ bool SingleFileStorageManager::IsCheckpointClean(MetaBlockPointer checkpoint_id)
 	return block_manager->IsRootBlock(checkpoint_id);
 }
 
-void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint) {
+void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint, bool concurrent_reads) {
 	if (InMemory() || read_only || !wal) {
 		return;
 	}
@@ -265,7 +266,7 @@ void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_chec
 	if (wal->GetWALSize() > 0 || config.options.force_checkpoint || force_checkpoint) {
 		// we only need to checkpoint if there is anything in the WAL
 		try {
-			SingleFileCheckpointWriter checkpointer(db, *block_manager);
+			SingleFileCheckpointWriter checkpointer(db, *block_manager, concurrent_reads);
 			checkpointer.CreateCheckpoint();
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
@@ -67,6 +67,13 @@ void ArrayColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row
 	}
 }
 
+void ArrayColumnData::InitializePrefetch(PrefetchState &prefetch_state, idx_t row_start, idx_t count) {
+	validity.InitializePrefetch(prefetch_state, row_start, count);
+	auto array_size = ArrayType::GetSize(type);
+	auto child_start = child_column->start + (row_start - start) * array_size;
+	child_column->InitializePrefetch(prefetch_state, child_start, count * array_size);
+}
+
 idx_t ArrayColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	return ScanCount(state, result, STANDARD_VECTOR_SIZE);
 }
@@ -3,8 +3,12 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/statistics/bloom_filter.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/list_column_data.hpp"
@@ -91,6 +95,55 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.last_offset = 0;
 }
 
+void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, idx_t row_start, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	auto l = data.Lock();
+	idx_t segment_index;
+	if (!data.TryGetSegmentIndex(l, row_start, segment_index)) {
+		return;
+	}
+	auto row_end = row_start + count;
+	auto segment = data.GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+	// only the segments that contain rows of the range are read by the scan
+	while (segment && segment->start < row_end) {
+		segment->InitializePrefetch(prefetch_state);
+		segment = data.GetNextSegment(l, segment);
+	}
+}
+
+void ColumnData::FilterPrefetchRanges(TableFilter &filter, vector<pair<idx_t, idx_t>> &row_ranges) {
+	auto l = data.Lock();
+	vector<pair<idx_t, idx_t>> result;
+	for (auto &range : row_ranges) {
+		idx_t segment_index;
+		if (!data.TryGetSegmentIndex(l, range.first, segment_index)) {
+			// the column has no segments for these rows: we cannot prune them
+			result.push_back(range);
+			continue;
+		}
+		auto segment = data.GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+		auto row_index = range.first;
+		while (segment && row_index < range.second) {
+			auto segment_end = MinValue<idx_t>(segment->start + segment->count, range.second);
+			// check the zonemap of the segment as the scan does
+			ColumnScanState segment_state;
+			segment_state.current = segment;
+			if (CheckZonemap(segment_state, filter)) {
+				if (!result.empty() && result.back().second == row_index) {
+					result.back().second = segment_end;
+				} else {
+					result.emplace_back(row_index, segment_end);
+				}
+			}
+			row_index = segment_end;
+			segment = data.GetNextSegment(l, segment);
+		}
+	}
+	row_ranges = std::move(result);
+}
+
 idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, bool has_updates) {
 	state.previous_states.clear();
 	if (!state.initialized) {
@@ -177,16 +230,85 @@ void ColumnData::FetchUpdateRow(TransactionData transaction, row_t row_id, Vecto
 void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                                 idx_t update_count, Vector &base_vector) {
 	lock_guard<mutex> update_guard(update_lock);
+	bloom_filter.reset();
 	if (!updates) {
 		updates = make_uniq<UpdateSegment>(*this);
 	}
 	updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 }
 
+idx_t ColumnData::GetVectorCount(idx_t vector_index) const {
+	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
+	return MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
+}
+
+static bool FilterSupportsCompressedEvaluation(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterSupportsCompressedEvaluation(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterSupportsCompressedEvaluation(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		// filters on NULL values cannot be evaluated on the compressed data as it does not contain the validity
+		return false;
+	}
+}
+
+bool ColumnData::CanFilterCompressed(ColumnScanState &state, idx_t scan_count, const TableFilter &filter) {
+	if (!state.current || !state.current->function.get().filter) {
+		return false;
+	}
+	if (HasUpdates() || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	// the entire vector must be contained in the current segment
+	auto &segment = *state.current;
+	if (state.row_index < segment.start || state.row_index + scan_count > segment.start + segment.count) {
+		return false;
+	}
+	return FilterSupportsCompressedEvaluation(filter);
+}
+
+void ColumnData::FilterVector(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel,
+                              idx_t &sel_count, const TableFilter &filter) {
+	state.previous_states.clear();
+	if (!state.initialized) {
+		D_ASSERT(state.current);
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.initialized = true;
+	}
+	D_ASSERT(data.HasSegment(state.current));
+	D_ASSERT(state.internal_index <= state.row_index);
+	if (state.internal_index < state.row_index) {
+		state.current->Skip(state);
+	}
+	D_ASSERT(state.current->type == type);
+	state.current->Filter(state, scan_count, result, sel, sel_count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+}
+
 template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 idx_t ColumnData::ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
-	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
-	auto vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
+	auto vector_count = GetVectorCount(vector_index);
 
 	auto scan_count = ScanVector(state, result, vector_count, HasUpdates());
 	FetchUpdates(transaction, vector_index, result, scan_count, ALLOW_UPDATES, SCAN_COMMITTED);
@@ -272,6 +394,43 @@ void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t append_c
 	Append(stats->statistics, state, vector, append_count);
 }
 
+//! Returns whether or not any value that passes the filter can be present according to the bloom filter
+static bool BloomFilterMightMatch(const BloomFilter &bloom_filter, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return true;
+		}
+		return bloom_filter.MightContain(constant_filter.constant);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return bloom_filter.MightContainAny(in_filter.values);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterMightMatch(bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterMightMatch(bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
 bool ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
@@ -281,9 +440,20 @@ bool ColumnData::CheckZonemap(TableFilter &filter) {
 	    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
 		return false;
 	}
+	if (propagate_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+		auto column_bloom_filter = GetBloomFilter();
+		if (column_bloom_filter && !BloomFilterMightMatch(*column_bloom_filter, filter)) {
+			return false;
+		}
+	}
 	return true;
 }
 
+shared_ptr<BloomFilter> ColumnData::GetBloomFilter() const {
+	lock_guard<mutex> update_guard(update_lock);
+	return bloom_filter;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	if (!stats) {
 		throw InternalException("ColumnData::GetStatistics called on a column without stats");
@@ -306,6 +476,11 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	{
+		// the bloom filter does not contain the appended values
+		lock_guard<mutex> update_guard(update_lock);
+		bloom_filter.reset();
+	}
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -481,6 +656,10 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group,
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	ClearUpdates();
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		bloom_filter = checkpoint_state->bloom_filter;
+	}
 
 	return checkpoint_state;
 }
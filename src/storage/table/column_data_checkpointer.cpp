@@ -4,6 +4,8 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/statistics/bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
@@ -197,9 +199,30 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	// collect the hashes of the values while compressing if we are building a bloom filter
+	bool build_bloom_filter = ShouldBuildBloomFilter();
+	vector<hash_t> bloom_filter_hashes;
+	Vector hash_vector(LogicalType::HASH);
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		best_function->compress(*compress_state, scan_vector, count);
+		if (!build_bloom_filter) {
+			return;
+		}
+		UnifiedVectorFormat vdata;
+		scan_vector.ToUnifiedFormat(count, vdata);
+		VectorOperations::Hash(scan_vector, hash_vector, count);
+		hash_vector.Flatten(count);
+		auto hashes = FlatVector::GetData<hash_t>(hash_vector);
+		for (idx_t i = 0; i < count; i++) {
+			if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+				bloom_filter_hashes.push_back(hashes[i]);
+			}
+		}
+	});
 	best_function->compress_finalize(*compress_state);
+	if (build_bloom_filter && !bloom_filter_hashes.empty()) {
+		state.bloom_filter = BloomFilter::Create(bloom_filter_hashes);
+	}
 
 	nodes.clear();
 }
@@ -222,9 +245,22 @@ bool ColumnDataCheckpointer::HasChanges() {
 	return false;
 }
 
+bool ColumnDataCheckpointer::ShouldBuildBloomFilter() {
+	if (is_validity || col_data.parent || !BloomFilter::TypeIsSupported(GetType())) {
+		// bloom filters are only checked for top-level columns
+		return false;
+	}
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	return config.options.enable_checkpoint_bloom_filters;
+}
+
 void ColumnDataCheckpointer::WritePersistentSegments() {
 	// all segments are persistent and there are no updates
 	// we only need to write the metadata
+	// the data is unchanged, so we can keep the bloom filter we have (if any) - unless bloom filters were disabled
+	if (ShouldBuildBloomFilter()) {
+		state.bloom_filter = col_data.GetBloomFilter();
+	}
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		D_ASSERT(segment->segment_type == ColumnSegmentType::PERSISTENT);
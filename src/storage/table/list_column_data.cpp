@@ -70,6 +70,12 @@ void ListColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_
 	state.last_offset = child_offset;
 }
 
+void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state, idx_t row_start, idx_t count) {
+	// the amount of child rows is only known while scanning: we only prefetch the offsets and the validity
+	ColumnData::InitializePrefetch(prefetch_state, row_start, count);
+	validity.InitializePrefetch(prefetch_state, row_start, count);
+}
+
 idx_t ListColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	return ScanCount(state, result, STANDARD_VECTOR_SIZE);
 }
@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/storage/table/column_data.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/row_version_manager.hpp"
+#include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
@@ -200,6 +202,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchNextRowGroup(state);
 	return true;
 }
 
@@ -229,9 +232,67 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchNextRowGroup(state);
 	return true;
 }
 
+void RowGroup::PrefetchNextRowGroup(CollectionScanState &state) {
+	if (!state.GetOptions().prefetch || !state.row_groups) {
+		return;
+	}
+	if (state.initialized_row_groups++ == 0) {
+		// a scan that stops early (e.g. because of a LIMIT) should not read blocks that it never uses - we only read
+		// ahead once the scan has moved past its first row group
+		return;
+	}
+	auto next = state.row_groups->GetNextSegment(this);
+	if (!next || next->start >= state.max_row) {
+		// the next row group is not scanned with this state (e.g. it is scanned by another thread of a parallel scan)
+		return;
+	}
+	// read the blocks of the next row group while the rows of this row group are scanned
+	next->Prefetch(state);
+}
+
+void RowGroup::Prefetch(CollectionScanState &state) {
+	auto &column_ids = state.GetColumnIds();
+	auto filters = state.GetFilters();
+	if (filters && !CheckZonemap(*filters, column_ids)) {
+		// the scan skips this row group entirely
+		return;
+	}
+	auto row_end = MinValue<idx_t>(this->start + this->count, state.max_row);
+	if (row_end <= this->start) {
+		return;
+	}
+	// figure out which rows the scan reads: the scan skips the rows of segments whose zonemap prunes a filter
+	vector<pair<idx_t, idx_t>> row_ranges;
+	row_ranges.emplace_back(this->start, row_end);
+	if (filters) {
+		for (auto &entry : filters->filters) {
+			GetColumn(column_ids[entry.first]).FilterPrefetchRanges(*entry.second, row_ranges);
+		}
+	}
+	// collect the on-disk blocks of the projected columns that hold these rows
+	PrefetchState prefetch_state;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &column_data = GetColumn(column);
+		for (auto &range : row_ranges) {
+			column_data.InitializePrefetch(prefetch_state, range.first, range.second - range.first);
+		}
+	}
+	if (prefetch_state.blocks.empty()) {
+		return;
+	}
+	// load the blocks that are not in memory yet with as few reads as possible
+	auto &buffer_manager = GetBlockManager().buffer_manager;
+	buffer_manager.Prefetch(prefetch_state.blocks);
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -397,6 +458,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -792,7 +854,6 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
                                         const vector<CompressionType> &compression_types) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
-	result.statistics.reserve(columns.size());
 
 	// Checkpoint the individual columns of the row group
 	// Here we're iterating over columns. Each column can have multiple segments.
@@ -803,19 +864,41 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info {compression_types[column_idx]};
-		auto checkpoint_state = column.Checkpoint(*this, manager, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+		result.states.push_back(WriteColumnToDisk(manager, column_idx, compression_types[column_idx]));
+	}
+	InitializeWriteStatistics(result);
+	return result;
+}
+
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(PartialBlockManager &manager, idx_t column_idx,
+                                                              CompressionType compression_type) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info {compression_type};
+	auto checkpoint_state = column.Checkpoint(*this, manager, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
 
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(RowGroupWriter &writer, idx_t column_idx) {
+	auto &column = GetColumn(column_idx);
+	if (column.count != this->count) {
+		throw InternalException("Corrupted in-memory column - column with index %llu has misaligned count (row "
+		                        "group has %llu rows, column has %llu)",
+		                        column_idx, this->count.load(), column.count);
+	}
+	return WriteColumnToDisk(writer.GetPartialBlockManager(), column_idx,
+	                         writer.GetColumnCompressionType(column_idx));
+}
+
+void RowGroup::InitializeWriteStatistics(RowGroupWriteData &write_data) {
+	D_ASSERT(write_data.statistics.empty());
+	write_data.statistics.reserve(write_data.states.size());
+	for (auto &checkpoint_state : write_data.states) {
+		D_ASSERT(checkpoint_state);
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
-
-		result.statistics.push_back(stats->Copy());
-		result.states.push_back(std::move(checkpoint_state));
+		write_data.statistics.push_back(stats->Copy());
 	}
-	D_ASSERT(result.states.size() == result.statistics.size());
-	return result;
 }
 
 idx_t RowGroup::GetCommittedRowCount() {
@@ -836,19 +919,13 @@ bool RowGroup::HasUnloadedDeletes() const {
 }
 
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
-	vector<CompressionType> compression_types;
-	compression_types.reserve(columns.size());
+	RowGroupWriteData result;
+	result.states.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		if (column.count != this->count) {
-			throw InternalException("Corrupted in-memory column - column with index %llu has misaligned count (row "
-			                        "group has %llu rows, column has %llu)",
-			                        column_idx, this->count.load(), column.count);
-		}
-		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+		result.states.push_back(WriteColumnToDisk(writer, column_idx));
 	}
-
-	return WriteToDisk(writer.GetPartialBlockManager(), compression_types);
+	InitializeWriteStatistics(result);
+	return result;
 }
 
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
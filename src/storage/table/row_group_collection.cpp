@@ -54,7 +54,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), vacuum_requested(false) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -704,21 +704,24 @@ protected:
 	CollectionCheckpointState &checkpoint_state;
 };
 
+//! Checkpoints a single column of a row group: the columns of all row groups are analyzed and compressed in parallel
 class CheckpointTask : public BaseCheckpointTask {
 public:
-	CheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index)
-	    : BaseCheckpointTask(checkpoint_state), index(index) {
+	CheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_idx)
+	    : BaseCheckpointTask(checkpoint_state), index(index), column_idx(column_idx) {
 	}
 
 	void ExecuteTask() override {
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
-		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
-		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
+		auto &writer = *checkpoint_state.writers[index];
+		// every task writes to its own column state, so no locking is required
+		checkpoint_state.write_data[index].states[column_idx] = row_group.WriteColumnToDisk(writer, column_idx);
 	}
 
 private:
 	idx_t index;
+	idx_t column_idx;
 };
 
 //===--------------------------------------------------------------------===//
@@ -726,6 +729,8 @@ private:
 //===--------------------------------------------------------------------===//
 struct VacuumState {
 	bool can_vacuum_deletes = false;
+	//! Whether or not row groups with enough deleted rows are rewritten (i.e. VACUUM was requested)
+	bool rewrite_deletes = false;
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
@@ -847,6 +852,7 @@ private:
 
 void RowGroupCollection::InitializeVacuumState(VacuumState &state, vector<SegmentNode<RowGroup>> &segments) {
 	state.can_vacuum_deletes = info->indexes.Empty();
+	state.rewrite_deletes = vacuum_requested.exchange(false);
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
@@ -867,6 +873,8 @@ void RowGroupCollection::InitializeVacuumState(VacuumState &state, vector<Segmen
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                              idx_t segment_idx) {
 	static constexpr const idx_t MAX_MERGE_COUNT = 3;
+	//! VACUUM rewrites a row group by itself when at least this percentage of its rows is deleted
+	static constexpr const idx_t VACUUM_DELETE_PERCENTAGE = 10;
 
 	if (!state.can_vacuum_deletes) {
 		// we cannot vacuum deletes - cannot vacuum
@@ -916,7 +924,19 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		// we cannot reduce the amount of row groups - on VACUUM rewrite this row group if enough rows are deleted
+		if (!state.rewrite_deletes) {
+			return false;
+		}
+		auto row_group_count = checkpoint_state.segments[segment_idx].node->count.load();
+		auto deleted_count = row_group_count - state.row_group_counts[segment_idx];
+		if (deleted_count == 0 || deleted_count * 100 < row_group_count * VACUUM_DELETE_PERCENTAGE) {
+			return false;
+		}
+		merge_rows = state.row_group_counts[segment_idx];
+		next_idx = segment_idx + 1;
+		merge_count = 1;
+		target_count = 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -932,8 +952,19 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 // Checkpoint
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx) {
-	auto checkpoint_task = make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
-	checkpoint_state.ScheduleTask(std::move(checkpoint_task));
+	auto &row_group = *checkpoint_state.segments[segment_idx].node;
+	checkpoint_state.writers[segment_idx] = checkpoint_state.writer.GetRowGroupWriter(row_group);
+	// schedule a task per column, the column states are gathered in order when the row groups are finalized
+	auto column_count = row_group.GetColumnCount();
+	checkpoint_state.write_data[segment_idx].states.resize(column_count);
+	for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+		auto checkpoint_task = make_uniq<CheckpointTask>(checkpoint_state, segment_idx, column_idx);
+		checkpoint_state.ScheduleTask(std::move(checkpoint_task));
+	}
+}
+
+void RowGroupCollection::RequestVacuum() {
+	vacuum_requested = true;
 }
 
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
@@ -989,8 +1020,9 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		if (!row_group_writer) {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
+		auto &write_data = checkpoint_state.write_data[segment_idx];
+		RowGroup::InitializeWriteStatistics(write_data);
+		auto pointer = row_group.Checkpoint(std::move(write_data), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
@@ -55,6 +55,10 @@ void ColumnScanState::Next(idx_t count) {
 	}
 }
 
+void PrefetchState::AddBlock(shared_ptr<BlockHandle> block) {
+	blocks.push_back(std::move(block));
+}
+
 const vector<storage_t> &CollectionScanState::GetColumnIds() {
 	return parent.GetColumnIds();
 }
@@ -77,7 +81,7 @@ ParallelCollectionScanState::ParallelCollectionScanState()
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
     : row_group(nullptr), vector_index(0), max_row_group_row(0), row_groups(nullptr), max_row(0), batch_index(0),
-      parent(parent_p) {
+      initialized_row_groups(0), parent(parent_p) {
 }
 
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
@@ -5,6 +5,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/statistics/bloom_filter.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 
@@ -63,6 +64,11 @@ void StandardColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t
 	validity.InitializeScanWithOffset(state.child_states[0], row_idx);
 }
 
+void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, idx_t row_start, idx_t count) {
+	ColumnData::InitializePrefetch(prefetch_state, row_start, count);
+	validity.InitializePrefetch(prefetch_state, row_start, count);
+}
+
 idx_t StandardColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
                                Vector &result) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
@@ -85,6 +91,36 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+                                SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
+	auto scan_count = GetVectorCount(vector_index);
+	if (!CanFilterCompressed(state, scan_count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, s_count, filter);
+		return;
+	}
+	// evaluate the filter directly on the compressed data of the segment
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	FilterVector(state, result, scan_count, sel, s_count, filter);
+	validity.Scan(transaction, vector_index, state.child_states[0], result);
+
+	// the compressed data does not know about NULL values - remove them from the selection
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	if (s_count == 0 || vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector new_sel(s_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		auto idx = sel.get_index(i);
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	s_count = result_count;
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 
@@ -183,6 +219,7 @@ public:
 		ColumnCheckpointState::WriteDataPointers(writer, serializer);
 		serializer.WriteObject(101, "validity",
 		                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
+		serializer.WritePropertyWithDefault(102, "bloom_filter", bloom_filter);
 	}
 };
 
@@ -218,6 +255,7 @@ void StandardColumnData::DeserializeColumn(Deserializer &deserializer, BaseStati
 	ColumnData::DeserializeColumn(deserializer, target_stats);
 	deserializer.ReadObject(
 	    101, "validity", [&](Deserializer &deserializer) { validity.DeserializeColumn(deserializer, target_stats); });
+	bloom_filter = deserializer.ReadPropertyWithDefault<shared_ptr<BloomFilter>>(102, "bloom_filter");
 }
 
 void StandardColumnData::GetColumnSegmentInfo(duckdb::idx_t row_group_index, vector<duckdb::idx_t> col_path,
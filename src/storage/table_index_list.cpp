@@ -148,7 +148,8 @@ vector<column_t> TableIndexList::GetRequiredColumns() {
 }
 
 vector<IndexStorageInfo> TableIndexList::GetStorageInfos() {
-
+	// serializing an index moves its buffers to disk: the optimizer must not scan it meanwhile
+	lock_guard<mutex> lock(indexes_lock);
 	vector<IndexStorageInfo> index_storage_infos;
 	for (auto &index : indexes) {
 		auto index_storage_info = index->GetStorageInfo(false);
@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(Storage::BLOCK_ALLOC_SIZE) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +97,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t block_size) {
+	if (block_size == Storage::BLOCK_ALLOC_SIZE) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files that hold compressed blocks have the size of their slots in their name
+	return "duckdb_temp_storage_" + to_string(block_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t block_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      block_size(block_size),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, block_size))),
+      index_manager(manager, block_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,16 +129,24 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	auto position = GetPositionInFile(index.block_index);
+	if (index.compressed_size == 0) {
+		buffer.Write(*handle, position);
+		return;
+	}
+	// the block is compressed: we only write the compressed data to its slot in the file
+	D_ASSERT(index.compressed_size <= block_size);
+	handle->Write(compressed_buffer.get(), index.compressed_size, position);
 }
 
-unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
+unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(TemporaryFileIndex index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	return StandardBufferManager::ReadTemporaryBufferInternal(
+	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(index.block_index), Storage::BLOCK_SIZE,
+	    index.compressed_size, std::move(reusable_buffer));
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -163,6 +183,9 @@ void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto open_flags = FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE;
+	if (DBConfig::GetConfig(db).options.use_direct_io) {
+		open_flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+	}
 	handle = fs.OpenFile(path, open_flags);
 }
 
@@ -180,7 +203,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * block_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -240,7 +263,7 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index)
-    : file_index(file_index), block_index(block_index) {
+    : file_index(file_index), block_index(block_index), compressed_size(0) {
 }
 
 bool TemporaryFileIndex::IsValid() const {
@@ -278,14 +301,22 @@ TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) :
 
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// compress the block (if enabled) before grabbing the lock
+	AllocatedData compressed_buffer;
+	auto compressed_size = CompressBuffer(db, buffer, compressed_buffer);
+	auto block_size = GetTemporaryBlockSize(compressed_size);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with slots of the right size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetBlockSize() != block_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,18 +326,65 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, block_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
 			index = handle->TryGetBlockIndex();
 		}
+		index.compressed_size = compressed_size;
 		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 		used_blocks[block_id] = index;
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+}
+
+idx_t TemporaryFileManager::CompressBuffer(DatabaseInstance &db, FileBuffer &buffer,
+                                           AllocatedData &compressed_buffer) {
+	auto &config = DBConfig::GetConfig(db);
+	if (!config.options.enable_temp_file_compression || buffer.size > LZ4_MAX_INPUT_SIZE) {
+		return 0;
+	}
+	auto source_size = NumericCast<int>(buffer.size);
+	auto bound = duckdb_lz4::LZ4_compressBound(source_size);
+	compressed_buffer = Allocator::Get(db).Allocate(NumericCast<idx_t>(bound));
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.buffer),
+	                                                        char_ptr_cast(compressed_buffer.get()), source_size, bound);
+	// we only store the compressed block if it saves at least an eighth of the size
+	// otherwise reading and decompressing the block is not worth it
+	if (compressed_size <= 0 || NumericCast<idx_t>(compressed_size) > buffer.size - buffer.size / 8) {
+		compressed_buffer.Reset();
+		return 0;
+	}
+	return NumericCast<idx_t>(compressed_size);
+}
+
+void TemporaryFileManager::DecompressBuffer(const_data_ptr_t compressed_data, idx_t compressed_size,
+                                            FileBuffer &buffer) {
+	auto decompressed_size =
+	    duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(compressed_data), char_ptr_cast(buffer.buffer),
+	                                    NumericCast<int>(compressed_size), NumericCast<int>(buffer.size));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer.size) {
+		throw IOException("Failed to decompress temporary buffer: the temporary file is corrupt");
+	}
+}
+
+idx_t TemporaryFileManager::GetTemporaryBlockSize(idx_t compressed_size) {
+	if (compressed_size == 0) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	// compressed blocks are stored in the smallest slot they fit in, so compression also saves disk space
+	static constexpr idx_t SLOT_EIGHTHS[] = {1, 2, 4, 6};
+	for (auto eighths : SLOT_EIGHTHS) {
+		auto slot_size = Storage::BLOCK_ALLOC_SIZE / 8 * eighths;
+		if (compressed_size <= slot_size) {
+			return slot_size;
+		}
+	}
+	return Storage::BLOCK_ALLOC_SIZE;
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -372,7 +450,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
-	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
+	auto buffer = handle->ReadTemporaryBuffer(index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
 		TemporaryManagerLock lock(manager_lock);
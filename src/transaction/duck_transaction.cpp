@@ -7,6 +7,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 #include "duckdb/transaction/append_info.hpp"
 #include "duckdb/transaction/delete_info.hpp"
@@ -16,6 +17,7 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -126,6 +128,38 @@ bool DuckTransaction::ChangesMade() {
 	return undo_buffer.ChangesMade() || storage->ChangesMade();
 }
 
+void DuckTransaction::SetReadWrite() {
+	if (write_lock) {
+		return;
+	}
+	// waits for a background checkpoint that is in progress to finish
+	write_lock = DuckTransactionManager::Get(manager.GetDB()).SharedWriteLock();
+}
+
+shared_ptr<StorageLockKey> DuckTransaction::SharedLockTable(DataTableInfo &info) {
+	unique_lock<mutex> guard(active_locks_lock);
+	auto entry = active_locks.find(info);
+	if (entry != active_locks.end()) {
+		auto lock = entry->second.lock();
+		if (lock) {
+			// another scan of this transaction holds the lock already: share it
+			// waiting for it instead could deadlock with a checkpoint that waits for that scan to finish
+			return lock;
+		}
+	}
+	// do not hold the lock of the map while we wait for a checkpoint of the table
+	guard.unlock();
+	shared_ptr<StorageLockKey> lock = info.checkpoint_lock.GetSharedLock();
+	guard.lock();
+	auto &active_lock = active_locks[info];
+	auto existing_lock = active_lock.lock();
+	if (existing_lock) {
+		return existing_lock;
+	}
+	active_lock = lock;
+	return lock;
+}
+
 bool DuckTransaction::AutomaticCheckpoint(AttachedDatabase &db) {
 	auto &storage_manager = db.GetStorageManager();
 	return storage_manager.AutomaticCheckpoint(storage->EstimatedSize() + undo_buffer.EstimatedSize());
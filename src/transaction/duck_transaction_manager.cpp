@@ -12,7 +12,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -43,7 +45,8 @@ struct CheckpointLock {
 };
 
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
-    : TransactionManager(db), thread_is_checkpointing(false) {
+    : TransactionManager(db), thread_is_checkpointing(false), checkpoint_requested(false),
+      checkpointer_signaled(false), checkpointer_shutdown(false) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
 	// transaction ID starts very high:
@@ -56,6 +59,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpointer();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -103,6 +107,12 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	if (thread_is_checkpointing) {
 		throw TransactionException("Cannot CHECKPOINT: another thread is checkpointing right now");
 	}
+	if (background_checkpoint_error.HasError()) {
+		// report the failure of the last background checkpoint - the next CHECKPOINT tries again
+		auto error = std::move(background_checkpoint_error);
+		background_checkpoint_error = ErrorData();
+		error.Throw("Background checkpoint failed: ");
+	}
 	CheckpointLock checkpoint_lock(*this);
 	checkpoint_lock.Lock();
 	if (current->ChangesMade()) {
@@ -148,6 +158,23 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint();
 }
 
+void DuckTransactionManager::Vacuum(ClientContext &context) {
+	auto &storage_manager = db.GetStorageManager();
+	if (storage_manager.InMemory()) {
+		return;
+	}
+	auto current = &DuckTransaction::Get(context, db);
+	lock_guard<mutex> lock(transaction_lock);
+	if (thread_is_checkpointing || current->ChangesMade() || !CanCheckpoint(current).can_checkpoint) {
+		// we cannot checkpoint right now - the requested vacuum is performed by the next checkpoint instead
+		return;
+	}
+	CheckpointLock checkpoint_lock(*this);
+	checkpoint_lock.Lock();
+	// checkpoint also if the WAL is empty so the row groups with deleted rows are rewritten
+	storage_manager.CreateCheckpoint(false, true);
+}
+
 DuckTransactionManager::CheckpointDecision
 DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 	if (db.IsSystem()) {
@@ -172,6 +199,9 @@ DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 	}
 
 	for (auto &transaction : active_transactions) {
+		if (!current) {
+			return {false, "there are active transactions"};
+		}
 		if (transaction.get() != current.get()) {
 			return {false, "current transaction [" + std::to_string(current->transaction_id) + "] isn't active"};
 		}
@@ -181,13 +211,23 @@ DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
+	if (!transaction.write_lock && (transaction.ChangesMade() || !transaction.sequence_usage.empty())) {
+		// the transaction modified the database without announcing it up front (e.g. through nextval)
+		// take the write lock before writing to the WAL, so that we do not commit while a background checkpoint runs
+		transaction.SetReadWrite();
+	}
 	vector<ClientLockWrapper> client_locks;
 	auto lock = make_uniq<lock_guard<mutex>>(transaction_lock);
 	CheckpointLock checkpoint_lock(*this);
 	// check if we can checkpoint
 	auto checkpoint_decision = thread_is_checkpointing ? CheckpointDecision {false, "another thread is checkpointing"}
 	                                                   : CanCheckpoint(&transaction);
-	if (checkpoint_decision.can_checkpoint) {
+	bool request_checkpoint = false;
+	if (BackgroundCheckpointEnabled()) {
+		// the commit is written to the WAL - the background checkpointer checkpoints once no transactions are active
+		request_checkpoint = !db.IsSystem() && transaction.AutomaticCheckpoint(db);
+		checkpoint_decision = {false, "automatic checkpoints are performed in the background"};
+	} else if (checkpoint_decision.can_checkpoint) {
 		if (transaction.AutomaticCheckpoint(db)) {
 			checkpoint_lock.Lock();
 		} else {
@@ -222,6 +262,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(false, true);
 	}
+	if (request_checkpoint && !error.HasError()) {
+		RequestBackgroundCheckpoint();
+	}
 	return error;
 }
 
@@ -239,6 +282,8 @@ void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 }
 
 void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noexcept {
+	// the transaction can no longer modify the database
+	transaction.write_lock.reset();
 	bool changes_made = transaction.ChangesMade();
 	// remove the transaction from the list of active transactions
 	idx_t t_index = active_transactions.size();
@@ -328,6 +373,133 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noe
 		// we garbage collected transactions: remove them from the list
 		old_transactions.erase(old_transactions.begin(), old_transactions.begin() + static_cast<int64_t>(i));
 	}
+	// a background checkpoint might be possible now
+	NotifyBackgroundCheckpointer();
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpointer
+//===--------------------------------------------------------------------===//
+bool DuckTransactionManager::BackgroundCheckpointEnabled() {
+#ifdef DUCKDB_NO_THREADS
+	return false;
+#else
+	return DBConfig::GetConfig(db.GetDatabase()).options.enable_background_checkpoint;
+#endif
+}
+
+void DuckTransactionManager::RequestBackgroundCheckpoint() {
+	{
+		lock_guard<mutex> guard(checkpointer_lock);
+		if (checkpointer_shutdown) {
+			return;
+		}
+		checkpoint_requested = true;
+		checkpointer_signaled = true;
+		if (!checkpointer) {
+			try {
+				checkpointer = make_uniq<thread>([this]() { RunBackgroundCheckpointer(); });
+			} catch (...) { // NOLINT
+				// we could not start the background checkpointer: the checkpoint is retried by the next commit
+				checkpoint_requested = false;
+				return;
+			}
+		}
+	}
+	checkpointer_cv.notify_one();
+}
+
+void DuckTransactionManager::NotifyBackgroundCheckpointer() noexcept {
+	{
+		lock_guard<mutex> guard(checkpointer_lock);
+		if (!checkpointer || !checkpoint_requested) {
+			return;
+		}
+		checkpointer_signaled = true;
+	}
+	checkpointer_cv.notify_one();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpointer() {
+	unique_ptr<thread> checkpointer_thread;
+	{
+		lock_guard<mutex> guard(checkpointer_lock);
+		checkpointer_shutdown = true;
+		checkpointer_thread = std::move(checkpointer);
+	}
+	checkpointer_cv.notify_one();
+	if (checkpointer_thread) {
+		checkpointer_thread->join();
+	}
+}
+
+void DuckTransactionManager::RunBackgroundCheckpointer() {
+	unique_lock<mutex> guard(checkpointer_lock);
+	while (true) {
+		checkpointer_cv.wait(guard, [&]() { return checkpointer_signaled || checkpointer_shutdown; });
+		if (checkpointer_shutdown) {
+			return;
+		}
+		checkpointer_signaled = false;
+		if (!checkpoint_requested) {
+			continue;
+		}
+		// the request is cleared once a checkpoint succeeds - until then, every finished transaction wakes us up
+		guard.unlock();
+		TryBackgroundCheckpoint();
+		guard.lock();
+	}
+}
+
+unique_ptr<StorageLockKey> DuckTransactionManager::SharedWriteLock() {
+	return write_lock.GetSharedLock();
+}
+
+bool DuckTransactionManager::TryBackgroundCheckpoint() {
+	unique_lock<mutex> lock(transaction_lock);
+	if (thread_is_checkpointing) {
+		return false;
+	}
+	// transactions that can modify the database hold the write lock: if we get it, no transaction can write to the
+	// tables or to the WAL until we are done
+	auto exclusive_write_lock = write_lock.TryGetExclusiveLock();
+	if (!exclusive_write_lock) {
+		// we are woken up again when a transaction finishes
+		return false;
+	}
+	if (!recently_committed_transactions.empty() || !old_transactions.empty()) {
+		// the active transactions might still need versions of rows that the checkpoint discards
+		return false;
+	}
+	CheckpointLock checkpoint_lock(*this);
+	checkpoint_lock.Lock();
+	// we only hold the transaction lock while we decide to checkpoint: transactions can start, read and commit while
+	// we checkpoint - transactions that want to modify the database wait for the write lock, and scans of a table
+	// wait only while its data is rewritten
+	lock.unlock();
+	ErrorData error;
+	try {
+		db.GetStorageManager().CreateCheckpoint(false, false, true);
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
+	} catch (...) { // LCOV_EXCL_START
+		error = ErrorData(ExceptionType::FATAL, "Unhandled exception in background checkpoint");
+	} // LCOV_EXCL_STOP
+	lock.lock();
+	checkpoint_lock.Unlock();
+	if (error.HasError()) {
+		// there is no query to report the error to: as in the inline path, errors that invalidate the database
+		// invalidate it here, so the next query reports the error - other errors are thrown by the next CHECKPOINT
+		if (Exception::InvalidatesDatabase(error.Type())) {
+			ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+		} else {
+			background_checkpoint_error = std::move(error);
+		}
+	}
+	// no transaction could request a checkpoint since we took the write lock: the request has been handled
+	lock_guard<mutex> guard(checkpointer_lock);
+	checkpoint_requested = false;
+	return true;
 }
 
 } // namespace duckdb
@@ -134,6 +134,7 @@ void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
 	}
 	if (!modified_database) {
 		modified_database = &db;
+		GetTransaction(db).SetReadWrite();
 		return;
 	}
 	if (&db != modified_database.get()) {
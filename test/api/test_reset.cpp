@@ -108,7 +108,15 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_http_metadata_cache", {true}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
-	    {"arrow_large_buffer_size", {true}}};
+	    {"arrow_large_buffer_size", {true}},
+	    {"enable_background_checkpoint", {true}},
+	    {"buffer_eviction_policy", {"2q"}},
+	    {"enable_checkpoint_bloom_filters", {true}},
+	    {"enable_huge_page_allocation", {true}},
+	    {"enable_temp_file_compression", {true}},
+	    {"enable_table_scan_prefetch", {false}},
+	    {"use_direct_io", {true}},
+	    {"enable_io_uring", {true}}};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
 		REQUIRE(name == "MISSING_FROM_MAP");
@@ -2,9 +2,15 @@
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/fstream.hpp"
+#include "duckdb/common/io_uring.hpp"
 #include "duckdb/common/local_file_system.hpp"
 #include "test_helpers.hpp"
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace duckdb;
 using namespace std;
 
@@ -97,6 +103,65 @@ TEST_CASE("Test file operations", "[file_system]") {
 	fs->RemoveFile(fname);
 }
 
+TEST_CASE("Test batched reads", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::unique_ptr<FileHandle> handle;
+	int64_t test_data[INTEGER_COUNT];
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		test_data[i] = i;
+	}
+	auto fname = TestCreatePath("test_file_batch");
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data, sizeof(int64_t) * INTEGER_COUNT, 0));
+	handle.reset();
+
+	// read the file back in four parts, in reverse order, with io_uring enabled
+	// if io_uring is not available this falls back to regular reads
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_IO_URING));
+	constexpr idx_t PART_COUNT = 4;
+	constexpr idx_t PART_SIZE = sizeof(int64_t) * INTEGER_COUNT / PART_COUNT;
+	int64_t result_data[INTEGER_COUNT];
+	memset(result_data, 0, sizeof(result_data));
+	FileReadRequest requests[PART_COUNT];
+	for (idx_t i = 0; i < PART_COUNT; i++) {
+		auto part = PART_COUNT - i - 1;
+		requests[i].buffer = data_ptr_cast(result_data) + part * PART_SIZE;
+		requests[i].nr_bytes = PART_SIZE;
+		requests[i].location = part * PART_SIZE;
+	}
+	REQUIRE_NOTHROW(handle->ReadBatch(requests, PART_COUNT));
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		REQUIRE(result_data[i] == i);
+	}
+
+	// a batch that reads past the end of the file fails
+	auto buffer = make_unsafe_uniq_array<data_t>(PART_SIZE * 2);
+	requests[0].buffer = buffer.get();
+	requests[0].nr_bytes = PART_SIZE;
+	requests[0].location = 0;
+	requests[1].buffer = buffer.get() + PART_SIZE;
+	requests[1].nr_bytes = PART_SIZE;
+	requests[1].location = sizeof(int64_t) * INTEGER_COUNT - PART_SIZE / 2;
+	REQUIRE_THROWS(handle->ReadBatch(requests, 2));
+
+#ifdef __linux__
+	// the ring itself reports the short read at the end of the file
+	auto ring = IOUring::TryCreate(2);
+	if (ring) {
+		int fd = open(fname.c_str(), O_RDONLY);
+		REQUIRE(fd >= 0);
+		int64_t results[2];
+		ring->Read(fd, requests, 2, results);
+		close(fd);
+		REQUIRE(results[0] == int64_t(PART_SIZE));
+		REQUIRE(results[1] == int64_t(PART_SIZE / 2));
+		REQUIRE(Load<int64_t>(buffer.get() + PART_SIZE) == INTEGER_COUNT - INTEGER_COUNT / PART_COUNT / 2);
+	}
+#endif
+	handle.reset();
+	fs->RemoveFile(fname);
+}
+
 TEST_CASE("absolute paths", "[file_system]") {
 	duckdb::LocalFileSystem fs;
 
@@ -114,6 +114,7 @@ color_map = {
     "ORDER_BY": "#facd60",
     "PERFECT_HASH_GROUP_BY": "#ffffba",
     "HASH_GROUP_BY": "#ffffba",
+    "STREAMING_GROUP_BY": "#ffffba",
     "NESTED_LOOP_JOIN": "#ffffba",
     "STREAMING_LIMIT": "#facd60",
     "COLUMN_DATA_SCAN": "#1ac0c6",
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -327,6 +328,16 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 			throw NotImplementedException("Comparison Type can't be an Arrow Scan Pushdown Filter");
 		}
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto in_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = in_field.attr("__eq__")(GetScalar(in_filter.values[0], timezone_config, type));
+		for (idx_t i = 1; i < in_filter.values.size(); i++) {
+			auto child_expression = in_field.attr("__eq__")(GetScalar(in_filter.values[i], timezone_config, type));
+			expression = expression.attr("__or__")(child_expression);
+		}
+		return expression;
+	}
 	//! We do not pushdown is null yet
 	case TableFilterType::IS_NULL: {
 		auto constant_field = field(py::tuple(py::cast(column_ref)));